@@ -102,6 +102,23 @@ class bullet_animation : public basic_animation
         }
 };
 
+#if defined(TILES)
+//! Lets the tiles renderer reuse the map it drew for the first frame of an animation
+//! for all later frames, for animations that do not change anything on the map.
+class held_scene
+{
+    public:
+        held_scene() {
+            tilecontext->hold_scene();
+        }
+        ~held_scene() {
+            tilecontext->release_scene();
+        }
+        held_scene( const held_scene & ) = delete;
+        held_scene &operator=( const held_scene & ) = delete;
+};
+#endif
+
 bool is_point_visible( const tripoint &p, int margin = 0 )
 {
     return g->is_in_viewport( p, margin ) && get_player_view().sees( p );
@@ -281,6 +298,7 @@ void explosion_handler::draw_explosion( const tripoint &p, const int r, const nc
     }
 
     explosion_animation anim;
+    held_scene scene;
 
     int i = 1;
     shared_ptr_fast<game::draw_callback_t> explosion_cb =
@@ -430,6 +448,7 @@ void explosion_handler::draw_custom_explosion( const tripoint &,
     }
 
     explosion_animation anim;
+    held_scene scene;
     // We need to draw all explosions up to now
     std::map<tripoint, explosion_tile> combined_layer;
 
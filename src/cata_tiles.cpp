@@ -32,6 +32,7 @@
 #include "filesystem.h"
 #include "game.h"
 #include "game_constants.h"
+#include "init.h"
 #include "int_id.h"
 #include "item.h"
 #include "item_factory.h"
@@ -328,6 +329,8 @@ void cata_tiles::load_tileset( const std::string &tileset_id, const bool prechec
     tileset_mutation_overlay_ordering.clear();
 
     tileset_ptr = cache.load_tileset( tileset_id, renderer, precheck, force, pump_events );
+    clear_looks_like_cache();
+    scene = held_scene();
 
     set_draw_scale( 16 );
 
@@ -1240,15 +1243,53 @@ void cata_tiles::draw( const point &dest, const tripoint &center, int width, int
     }
 #endif
 
+    sprites_drawn = 0;
+    const SDL_Rect clipRect = {dest.x, dest.y, width, height};
+    if( scene.held && scene.valid && scene.dest == dest && scene.center == center &&
+        scene.width == width && scene.height == height && scene.tile_width == tile_width &&
+        scene.tile_height == tile_height ) {
+        // nothing on the map changed since the scene was drawn, only the animation did
+        printErrorIf( SDL_RenderSetClipRect( renderer.get(), &clipRect ) != 0,
+                      "SDL_RenderSetClipRect failed" );
+        RenderCopy( renderer, scene.texture, &clipRect, &clipRect );
+        overlay_strings.insert( scene.overlay_strings.begin(), scene.overlay_strings.end() );
+        color_blocks = scene.color_blocks;
+        sprite_batch.begin();
+        draw_animation_frames( center, overlay_strings );
+        sprite_batch.end( renderer );
+        printErrorIf( SDL_RenderSetClipRect( renderer.get(), nullptr ) != 0,
+                      "SDL_RenderSetClipRect failed" );
+        return;
+    }
+
+    bool capture_scene = false;
+    if( scene.held ) {
+        // draw the map into a texture so the following frames can reuse it
+        const point texture_size( dest.x + width, dest.y + height );
+        if( !scene.texture || scene.texture_size != texture_size ) {
+            scene.texture = CreateTexture( renderer, SDL_PIXELFORMAT_ARGB8888,
+                                           SDL_TEXTUREACCESS_TARGET, texture_size.x, texture_size.y );
+            if( scene.texture ) {
+                // The captured scene replaces what is on screen, it must not be blended over it
+                SetTextureBlendMode( scene.texture, SDL_BLENDMODE_NONE );
+            }
+            scene.texture_size = texture_size;
+        }
+        capture_scene = static_cast<bool>( scene.texture );
+        if( capture_scene ) {
+            SetRenderTarget( renderer, scene.texture );
+        }
+    }
+
     {
         //set clipping to prevent drawing over stuff we shouldn't
-        SDL_Rect clipRect = {dest.x, dest.y, width, height};
         printErrorIf( SDL_RenderSetClipRect( renderer.get(), &clipRect ) != 0,
                       "SDL_RenderSetClipRect failed" );
 
         //fill render area with black to prevent artifacts where no new pixels are drawn
         geometry->rect( renderer, clipRect, SDL_Color() );
     }
+    sprite_batch.begin();
 
     point s;
     get_window_tile_counts( width, height, s.x, s.y );
@@ -1673,6 +1714,34 @@ void cata_tiles::draw( const point &dest, const tripoint &center, int width, int
         }
     }
 
+    if( capture_scene ) {
+        sprite_batch.flush( renderer );
+        set_displaybuffer_rendertarget();
+        RenderCopy( renderer, scene.texture, &clipRect, &clipRect );
+        printErrorIf( SDL_RenderSetClipRect( renderer.get(), &clipRect ) != 0,
+                      "SDL_RenderSetClipRect failed" );
+        scene.valid = true;
+        scene.dest = dest;
+        scene.center = center;
+        scene.width = width;
+        scene.height = height;
+        scene.tile_width = tile_width;
+        scene.tile_height = tile_height;
+        scene.overlay_strings = overlay_strings;
+        scene.color_blocks = color_blocks;
+    }
+
+    draw_animation_frames( center, overlay_strings );
+    sprite_batch.end( renderer );
+
+    printErrorIf( SDL_RenderSetClipRect( renderer.get(), nullptr ) != 0,
+                  "SDL_RenderSetClipRect failed" );
+}
+
+void cata_tiles::draw_animation_frames( const tripoint &center,
+                                        std::multimap<point, formatted_text> &overlay_strings )
+{
+    const avatar &you = get_avatar();
     in_animation = do_draw_explosion || do_draw_custom_explosion ||
                    do_draw_bullet || do_draw_hit || do_draw_line ||
                    do_draw_cursor || do_draw_highlight || do_draw_weather ||
@@ -1732,9 +1801,20 @@ void cata_tiles::draw( const point &dest, const tripoint &center, int width, int
                                  0, 0, lit_level::LIT, false );
         }
     }
+}
 
-    printErrorIf( SDL_RenderSetClipRect( renderer.get(), nullptr ) != 0,
-                  "SDL_RenderSetClipRect failed" );
+void cata_tiles::hold_scene()
+{
+    scene.held = SDL_RenderTargetSupported( renderer.get() ) == SDL_TRUE;
+    scene.valid = false;
+}
+
+void cata_tiles::release_scene()
+{
+    scene.held = false;
+    scene.valid = false;
+    scene.overlay_strings.clear();
+    scene.color_blocks.second.clear();
 }
 
 void cata_tiles::draw_minimap( const point &dest, const tripoint &center, int width, int height )
@@ -1820,6 +1900,16 @@ cata_tiles::find_tile_looks_like_by_string_id( const std::string &id, TILE_CATEG
     return find_tile_looks_like( obj.looks_like, category, "", looks_like_jumps_limit - 1 );
 }
 
+void cata_tiles::clear_looks_like_cache() const
+{
+    for( auto &by_season : looks_like_cache ) {
+        for( std::unordered_map<std::string, cata::optional<tile_lookup_res>> &by_id : by_season ) {
+            by_id.clear();
+        }
+    }
+    looks_like_cache_generation = DynamicDataLoader::get_instance().get_data_generation();
+}
+
 cata::optional<tile_lookup_res>
 cata_tiles::find_tile_looks_like( const std::string &id, TILE_CATEGORY category,
                                   const std::string &variant,
@@ -1829,6 +1919,40 @@ cata_tiles::find_tile_looks_like( const std::string &id, TILE_CATEGORY category,
         return cata::nullopt;
     }
 
+    // Try the variant first, without it the lookup is the same as for the plain id
+    if( !variant.empty() ) {
+        cata::optional<tile_lookup_res> tile_variant_with_season =
+            find_tile_with_season( id + "_var_" + variant );
+        if( tile_variant_with_season ) {
+            return tile_variant_with_season;
+        }
+    }
+
+    // Only chains of full length are cached, the shorter ones of nested looks_like jumps
+    // may give up earlier.
+    if( looks_like_jumps_limit != default_looks_like_jumps_limit ) {
+        return find_tile_looks_like_uncached( id, category, looks_like_jumps_limit );
+    }
+    if( looks_like_cache_generation != DynamicDataLoader::get_instance().get_data_generation() ) {
+        clear_looks_like_cache();
+    }
+    const season_type season = season_of_year( calendar::turn );
+    std::unordered_map<std::string, cata::optional<tile_lookup_res>> &by_id =
+                looks_like_cache[static_cast<int>( category )][season];
+    const auto iter = by_id.find( id );
+    if( iter != by_id.end() ) {
+        return iter->second;
+    }
+    cata::optional<tile_lookup_res> res = find_tile_looks_like_uncached( id, category,
+                                          looks_like_jumps_limit );
+    by_id.emplace( id, res );
+    return res;
+}
+
+cata::optional<tile_lookup_res>
+cata_tiles::find_tile_looks_like_uncached( const std::string &id, TILE_CATEGORY category,
+        const int looks_like_jumps_limit ) const
+{
     /*
     *  Note on memory management:
     *  This method must returns pointers to the objects (std::string *id  and tile_type * tile)
@@ -1838,23 +1962,9 @@ cata_tiles::find_tile_looks_like( const std::string &id, TILE_CATEGORY category,
     *  The result of `find_tile_with_season` is OK to be returned, because it's guaranteed to
     *  return pointers to the keys and values that are stored inside the `tileset_ptr`.
     */
-    // Try the variant first
-    if( !variant.empty() ) {
-        auto tile_variant_with_season = find_tile_with_season( id + "_var_" + variant );
-        if( tile_variant_with_season ) {
-            return tile_variant_with_season;
-        } else {
-            // Then try the non-variant
-            auto tile_with_season = find_tile_with_season( id );
-            if( tile_with_season ) {
-                return tile_with_season;
-            }
-        }
-    } else {
-        auto tile_with_season = find_tile_with_season( id );
-        if( tile_with_season ) {
-            return tile_with_season;
-        }
+    auto tile_with_season = find_tile_with_season( id );
+    if( tile_with_season ) {
+        return tile_with_season;
     }
 
     // Then do looks_like
@@ -2495,7 +2605,7 @@ bool cata_tiles::draw_sprite_at(
             default:
             case 0:
                 // unrotated (and 180, with just two sprites)
-                ret = sprite_tex->render_copy_ex( renderer, &destination, 0, nullptr,
+                ret = sprite_tex->render_copy_ex( sprite_batch, renderer, &destination, 0,
                                                   SDL_FLIP_NONE );
                 break;
             case 1:
@@ -2509,10 +2619,10 @@ bool cata_tiles::draw_sprite_at(
 #endif
                 if( !tile_iso ) {
                     // never rotate isometric tiles
-                    ret = sprite_tex->render_copy_ex( renderer, &destination, -90, nullptr,
+                    ret = sprite_tex->render_copy_ex( sprite_batch, renderer, &destination, -90,
                                                       SDL_FLIP_NONE );
                 } else {
-                    ret = sprite_tex->render_copy_ex( renderer, &destination, 0, nullptr,
+                    ret = sprite_tex->render_copy_ex( sprite_batch, renderer, &destination, 0,
                                                       SDL_FLIP_NONE );
                 }
                 break;
@@ -2521,10 +2631,10 @@ bool cata_tiles::draw_sprite_at(
                 if( !tile_iso ) {
                     // never flip isometric tiles vertically
                     ret = sprite_tex->render_copy_ex(
-                              renderer, &destination, 0, nullptr,
+                              sprite_batch, renderer, &destination, 0,
                               static_cast<SDL_RendererFlip>( SDL_FLIP_HORIZONTAL | SDL_FLIP_VERTICAL ) );
                 } else {
-                    ret = sprite_tex->render_copy_ex( renderer, &destination, 0, nullptr,
+                    ret = sprite_tex->render_copy_ex( sprite_batch, renderer, &destination, 0,
                                                       SDL_FLIP_NONE );
                 }
                 break;
@@ -2539,25 +2649,26 @@ bool cata_tiles::draw_sprite_at(
 #endif
                 if( !tile_iso ) {
                     // never rotate isometric tiles
-                    ret = sprite_tex->render_copy_ex( renderer, &destination, 90, nullptr,
+                    ret = sprite_tex->render_copy_ex( sprite_batch, renderer, &destination, 90,
                                                       SDL_FLIP_NONE );
                 } else {
-                    ret = sprite_tex->render_copy_ex( renderer, &destination, 0, nullptr,
+                    ret = sprite_tex->render_copy_ex( sprite_batch, renderer, &destination, 0,
                                                       SDL_FLIP_NONE );
                 }
                 break;
             case 4:
                 // flip horizontally
                 ret = sprite_tex->render_copy_ex(
-                          renderer, &destination, 0, nullptr,
+                          sprite_batch, renderer, &destination, 0,
                           static_cast<SDL_RendererFlip>( SDL_FLIP_HORIZONTAL ) );
         }
     } else {
         // don't rotate, same as case 0 above
-        ret = sprite_tex->render_copy_ex( renderer, &destination, 0, nullptr, SDL_FLIP_NONE );
+        ret = sprite_tex->render_copy_ex( sprite_batch, renderer, &destination, 0, SDL_FLIP_NONE );
     }
 
     printErrorIf( ret != 0, "SDL_RenderCopyEx() failed" );
+    sprites_drawn++;
     // this reference passes all the way back up the call chain back to
     // cata_tiles::draw() std::vector<tile_render_info> draw_points[].height_3d
     // where we are accumulating the height of every sprite stacked up in a tile
@@ -2678,6 +2789,7 @@ bool cata_tiles::draw_terrain_below( const tripoint &p, const lit_level, int &,
     if( tile_iso ) {
         belowRect.y += tile_height / 8;
     }
+    sprite_batch.flush( renderer );
     geometry->rect( renderer, belowRect, tercol );
 
     return true;
@@ -2748,7 +2860,7 @@ bool cata_tiles::draw_terrain( const tripoint &p, const lit_level ll, int &heigh
         // try drawing memory if invisible and not overridden
         const memorized_terrain_tile &t = get_terrain_memory_at( p );
         return draw_from_id_string(
-                   t.tile, TILE_CATEGORY::TERRAIN, empty_string, p, t.subtile, t.rotation,
+                   t.get_id(), TILE_CATEGORY::TERRAIN, empty_string, p, t.subtile, t.rotation,
                    lit_level::MEMORIZED, nv_goggles_activated, height_3d );
     }
     return false;
@@ -2759,7 +2871,7 @@ bool cata_tiles::has_memory_at( const tripoint &p ) const
     avatar &you = get_avatar();
     if( you.should_show_map_memory() ) {
         const memorized_terrain_tile t = you.get_memorized_tile( get_map().getabs( p ) );
-        return !t.tile.empty();
+        return !t.get_id().empty();
     }
     return false;
 }
@@ -2769,7 +2881,7 @@ bool cata_tiles::has_terrain_memory_at( const tripoint &p ) const
     avatar &you = get_avatar();
     if( you.should_show_map_memory() ) {
         const memorized_terrain_tile t = you.get_memorized_tile( get_map().getabs( p ) );
-        if( string_starts_with( t.tile, "t_" ) ) {
+        if( string_starts_with( t.get_id(), "t_" ) ) {
             return true;
         }
     }
@@ -2781,7 +2893,7 @@ bool cata_tiles::has_furniture_memory_at( const tripoint &p ) const
     avatar &you = get_avatar();
     if( you.should_show_map_memory() ) {
         const memorized_terrain_tile t = you.get_memorized_tile( get_map().getabs( p ) );
-        if( string_starts_with( t.tile, "f_" ) ) {
+        if( string_starts_with( t.get_id(), "f_" ) ) {
             return true;
         }
     }
@@ -2793,7 +2905,7 @@ bool cata_tiles::has_trap_memory_at( const tripoint &p ) const
     avatar &you = get_avatar();
     if( you.should_show_map_memory() ) {
         const memorized_terrain_tile t = you.get_memorized_tile( get_map().getabs( p ) );
-        if( string_starts_with( t.tile, "tr_" ) ) {
+        if( string_starts_with( t.get_id(), "tr_" ) ) {
             return true;
         }
     }
@@ -2805,7 +2917,7 @@ bool cata_tiles::has_vpart_memory_at( const tripoint &p ) const
     avatar &you = get_avatar();
     if( you.should_show_map_memory() ) {
         const memorized_terrain_tile t = you.get_memorized_tile( get_map().getabs( p ) );
-        if( string_starts_with( t.tile, "vp_" ) ) {
+        if( string_starts_with( t.get_id(), "vp_" ) ) {
             return true;
         }
     }
@@ -2817,7 +2929,7 @@ memorized_terrain_tile cata_tiles::get_terrain_memory_at( const tripoint &p ) co
     avatar &you = get_avatar();
     if( you.should_show_map_memory() ) {
         memorized_terrain_tile t = you.get_memorized_tile( get_map().getabs( p ) );
-        if( string_starts_with( t.tile, "t_" ) ) {
+        if( string_starts_with( t.get_id(), "t_" ) ) {
             return t;
         }
     }
@@ -2829,7 +2941,7 @@ memorized_terrain_tile cata_tiles::get_furniture_memory_at( const tripoint &p )
     avatar &you = get_avatar();
     if( you.should_show_map_memory() ) {
         memorized_terrain_tile t = you.get_memorized_tile( get_map().getabs( p ) );
-        if( string_starts_with( t.tile, "f_" ) ) {
+        if( string_starts_with( t.get_id(), "f_" ) ) {
             return t;
         }
     }
@@ -2841,7 +2953,7 @@ memorized_terrain_tile cata_tiles::get_trap_memory_at( const tripoint &p ) const
     avatar &you = get_avatar();
     if( you.should_show_map_memory() ) {
         memorized_terrain_tile t = you.get_memorized_tile( get_map().getabs( p ) );
-        if( string_starts_with( t.tile, "tr_" ) ) {
+        if( string_starts_with( t.get_id(), "tr_" ) ) {
             return t;
         }
     }
@@ -2853,7 +2965,7 @@ memorized_terrain_tile cata_tiles::get_vpart_memory_at( const tripoint &p ) cons
     avatar &you = get_avatar();
     if( you.should_show_map_memory() ) {
         memorized_terrain_tile t = you.get_memorized_tile( get_map().getabs( p ) );
-        if( string_starts_with( t.tile, "vp_" ) ) {
+        if( string_starts_with( t.get_id(), "vp_" ) ) {
             return t;
         }
     }
@@ -2943,7 +3055,7 @@ bool cata_tiles::draw_furniture( const tripoint &p, const lit_level ll, int &hei
         // try drawing memory if invisible and not overridden
         const memorized_terrain_tile &t = get_furniture_memory_at( p );
         return draw_from_id_string(
-                   t.tile, TILE_CATEGORY::FURNITURE, empty_string, p, t.subtile, t.rotation,
+                   t.get_id(), TILE_CATEGORY::FURNITURE, empty_string, p, t.subtile, t.rotation,
                    lit_level::MEMORIZED, nv_goggles_activated, height_3d );
     }
     return false;
@@ -3021,7 +3133,7 @@ bool cata_tiles::draw_trap( const tripoint &p, const lit_level ll, int &height_3
         // try drawing memory if invisible and not overridden
         const memorized_terrain_tile &t = get_trap_memory_at( p );
         return draw_from_id_string(
-                   t.tile, TILE_CATEGORY::TRAP, empty_string, p, t.subtile, t.rotation,
+                   t.get_id(), TILE_CATEGORY::TRAP, empty_string, p, t.subtile, t.rotation,
                    lit_level::MEMORIZED, nv_goggles_activated, height_3d );
     }
     return false;
@@ -3419,7 +3531,7 @@ bool cata_tiles::draw_vpart( const tripoint &p, lit_level ll, int &height_3d,
         // try drawing memory if invisible and not overridden
         const memorized_terrain_tile &t = get_vpart_memory_at( p );
         return draw_from_id_string(
-                   t.tile, TILE_CATEGORY::VEHICLE_PART, empty_string, p, t.subtile, t.rotation,
+                   t.get_id(), TILE_CATEGORY::VEHICLE_PART, empty_string, p, t.subtile, t.rotation,
                    lit_level::MEMORIZED, nv_goggles_activated, height_3d );
     }
     return false;
@@ -3475,6 +3587,7 @@ bool cata_tiles::draw_critter_at_below( const tripoint &p, const lit_level, int
         belowRect.y += tile_height / 8;
     }
 
+    sprite_batch.flush( renderer );
     geometry->rect( renderer, belowRect, tercol );
 
     return true;
@@ -3634,7 +3747,7 @@ bool cata_tiles::draw_zombie_revival_indicators( const tripoint &pos, const lit_
     map &here = get_map();
     if( tileset_ptr->find_tile_type( ZOMBIE_REVIVAL_INDICATOR ) && !invisible[0] &&
         item_override.find( pos ) == item_override.end() &&
-        here.could_see_items( pos, get_player_character() ) ) {
+        here.sees_some_items( pos, get_player_character() ) ) {
         for( item &i : here.i_at( pos ) ) {
             if( i.can_revive() ) {
                 return draw_from_id_string( ZOMBIE_REVIVAL_INDICATOR, TILE_CATEGORY::NONE,
@@ -23,6 +23,7 @@
 #include "point.h"
 #include "sdl_wrappers.h"
 #include "sdl_geometry.h"
+#include "sdl_sprite_batch.h"
 #include "type_id.h"
 #include "weather.h"
 #include "weighted_list.h"
@@ -106,6 +107,12 @@ class texture
             return SDL_RenderCopyEx( renderer.get(), sdl_texture_ptr.get(), &srcrect, dstrect, angle, center,
                                      flip );
         }
+        /// Like @ref render_copy_ex with a null rotation center, but queues the copy in @p batch.
+        int render_copy_ex( SpriteBatch &batch, const SDL_Renderer_Ptr &renderer,
+                            const SDL_Rect *const dstrect, const double angle,
+                            const SDL_RendererFlip flip ) const {
+            return batch.copy_ex( renderer, sdl_texture_ptr.get(), srcrect, *dstrect, angle, flip );
+        }
 };
 
 class layer_variant
@@ -366,6 +373,11 @@ class cata_tiles
             return tileset_ptr != nullptr;
         }
 
+        /** Number of sprites the last call to @ref draw rendered */
+        int get_sprites_drawn() const {
+            return sprites_drawn;
+        }
+
         /** Draw to screen */
         void draw( const point &dest, const tripoint &center, int width, int height,
                    std::multimap<point, formatted_text> &overlay_strings,
@@ -381,9 +393,15 @@ class cata_tiles
 
         cata::optional<tile_lookup_res> find_tile_with_season( const std::string &id ) const;
 
+        /** How many looks_like jumps are followed by default, only these lookups are cached */
+        static constexpr int default_looks_like_jumps_limit = 10;
+
         cata::optional<tile_lookup_res>
         find_tile_looks_like( const std::string &id, TILE_CATEGORY category, const std::string &variant,
-                              int looks_like_jumps_limit = 10 ) const;
+                              int looks_like_jumps_limit = default_looks_like_jumps_limit ) const;
+        cata::optional<tile_lookup_res>
+        find_tile_looks_like_uncached( const std::string &id, TILE_CATEGORY category,
+                                       int looks_like_jumps_limit ) const;
 
         // this templated method is used only from it's own cpp file, so it's ok to declare it here
         template<typename T>
@@ -484,6 +502,15 @@ class cata_tiles
         bool draw_item_highlight( const tripoint &pos );
 
     public:
+        /**
+         * Marks the start of a multi-frame animation during which the map does not change.
+         * The first frame draws the map into a texture, later frames copy that texture and
+         * only draw the animation layers on top of it.
+         */
+        void hold_scene();
+        /** Ends the animation started by @ref hold_scene, later frames draw the map again */
+        void release_scene();
+
         // Animation layers
         void init_explosion( const tripoint &p, int radius );
         void draw_explosion_frame();
@@ -634,6 +661,16 @@ class cata_tiles
         tileset_cache &cache;
         std::shared_ptr<const tileset> tileset_ptr;
 
+        /**
+         * Results of @ref find_tile_looks_like for full length looks-like chains, by category and
+         * season. They depend on the tileset and on the loaded game data, so the cache is cleared
+         * when a tileset is loaded and whenever the game data generation changes.
+         */
+        mutable std::unordered_map<std::string, cata::optional<tile_lookup_res>>
+        looks_like_cache[static_cast<int>( TILE_CATEGORY::last )][season_type::NUM_SEASONS];
+        mutable int looks_like_cache_generation = -1;
+        void clear_looks_like_cache() const;
+
         int tile_height = 0;
         int tile_width = 0;
         // The width and height of the area we can draw in,
@@ -709,6 +746,30 @@ class cata_tiles
          */
         bool nv_goggles_activated = false;
 
+        int sprites_drawn = 0;
+        /** Sprites drawn by @ref draw are submitted in batches */
+        SpriteBatch sprite_batch;
+
+        /** The map as drawn on the first frame after @ref hold_scene */
+        struct held_scene {
+            bool held = false;
+            bool valid = false;
+            point dest;
+            tripoint center;
+            int width = 0;
+            int height = 0;
+            int tile_width = 0;
+            int tile_height = 0;
+            SDL_Texture_Ptr texture;
+            point texture_size;
+            std::multimap<point, formatted_text> overlay_strings;
+            color_block_overlay_container color_blocks;
+        };
+        held_scene scene;
+        /** Draws the animation layers and cursors that are drawn on top of the map */
+        void draw_animation_frames( const tripoint &center,
+                                    std::multimap<point, formatted_text> &overlay_strings );
+
         pimpl<pixel_minimap> minimap;
 
     public:
@@ -6020,7 +6020,7 @@ void Character::mend_item( item_location &&obj, bool interactive )
         return;
     }
 
-    inventory inv = crafting_inventory();
+    const inventory &inv = crafting_inventory();
 
     struct mending_option {
         fault_id fault;
@@ -7045,6 +7045,9 @@ void Character::recalculate_enchantment_cache()
         }
     }
 
+    // enchantments may grant mutations
+    trait_flag_cache.valid = false;
+
     if( enchantment_cache->modifies_bodyparts() ) {
         recalculate_bodyparts();
     }
@@ -8572,7 +8575,7 @@ std::list<item> Character::use_charges( const itype_id &what, int qty, const int
                                         const std::function<bool( const item & )> &filter, bool in_tools )
 {
     std::list<item> res;
-    inventory inv = crafting_inventory( pos(), radius, true );
+    const inventory &inv = crafting_inventory( pos(), radius, true );
 
     if( qty <= 0 ) {
         return res;
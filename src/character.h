@@ -4,6 +4,7 @@
 
 #include <functional>
 #include <algorithm>
+#include <array>
 #include <bitset>
 #include <climits>
 #include <cstdint>
@@ -3413,6 +3414,17 @@ class Character : public Creature, public visitable
          * Pointers to mutation branches in @ref my_mutations.
          */
         std::vector<const mutation_branch *> cached_mutations;
+        /**
+         * For @ref count_trait_flag: how many mutations (including ones granted by enchantments)
+         * have each flag unconditionally, and which mutations have flags depending on whether
+         * they are active. Rebuilt on demand after mutations or the enchantment cache changed.
+         */
+        struct trait_flag_cache_type {
+            bool valid = false;
+            std::map<json_character_flag, int> flag_counts;
+            std::vector<const mutation_branch *> activated;
+        };
+        mutable trait_flag_cache_type trait_flag_cache;
 
         // if the player puts on and takes off items these mutations
         // are added or removed at the beginning of the next
@@ -3546,13 +3558,28 @@ class Character : public Creature, public visitable
         struct weighted_int_list<std::string> melee_miss_reasons;
 
         struct crafting_cache_type {
-            time_point time;
-            int moves;
-            tripoint position;
-            int radius;
-            pimpl<inventory> crafting_inventory;
+            struct entry {
+                time_point time = calendar::before_time_starts;
+                int moves = 0;
+                tripoint position = tripoint_min;
+                int radius = -1;
+                bool clear_path = false;
+                pimpl<inventory> crafting_inventory;
+            };
+            // Carried items, pseudo items and burrowing tools, formed at the time and moves below.
+            // Shared by all entries so that querying a new position only collects map items.
+            time_point time = calendar::before_time_starts;
+            int moves = 0;
+            pimpl<inventory> carried;
+            std::map<itype_id, int> carried_liquid_containers;
+            // Recently formed crafting inventories, reused round robin and rebuilt in place so
+            // references handed out earlier stay valid.
+            std::array<entry, 4> entries;
+            size_t next_entry = 0;
         };
         mutable crafting_cache_type crafting_cache;
+        /** Refreshes the carried part of crafting_cache, shared by all crafting inventories. */
+        void form_carried_crafting_inventory() const;
 
         time_point melee_warning_turn = calendar::turn_zero;
 
@@ -494,7 +494,7 @@ std::vector<const item *> Character::get_eligible_containers_for_crafting() cons
         if( pos() != loc && !here.clear_path( pos(), loc, PICKUP_RANGE, 1, 100 ) ) {
             continue;
         }
-        if( here.accessible_items( loc ) ) {
+        if( here.has_items( loc ) && here.accessible_items( loc ) ) {
             for( const item &it : here.i_at( loc ) ) {
                 std::vector<const item *> eligible = get_eligible_containers_recursive( it, true );
                 conts.insert( conts.begin(), eligible.begin(), eligible.end() );
@@ -557,18 +557,39 @@ const inventory &Character::crafting_inventory( const tripoint &src_pos, int rad
     if( src_pos == tripoint_zero ) {
         inv_pos = pos();
     }
-    if( moves == crafting_cache.moves
-        && radius == crafting_cache.radius
-        && calendar::turn == crafting_cache.time
-        && inv_pos == crafting_cache.position ) {
-        return *crafting_cache.crafting_inventory;
+    if( moves != crafting_cache.moves || calendar::turn != crafting_cache.time ) {
+        form_carried_crafting_inventory();
     }
-    crafting_cache.crafting_inventory->clear();
+    for( crafting_cache_type::entry &e : crafting_cache.entries ) {
+        if( e.time == crafting_cache.time && e.moves == crafting_cache.moves &&
+            e.position == inv_pos && e.radius == radius && e.clear_path == clear_path ) {
+            return *e.crafting_inventory;
+        }
+    }
+
+    crafting_cache_type::entry &e = crafting_cache.entries[crafting_cache.next_entry];
+    crafting_cache.next_entry = ( crafting_cache.next_entry + 1 ) % crafting_cache.entries.size();
+    e.crafting_inventory->clear();
     if( radius >= 0 ) {
-        crafting_cache.crafting_inventory->form_from_map( inv_pos, radius, this, false, clear_path );
+        e.crafting_inventory->form_from_map( inv_pos, radius, this, false, clear_path );
     }
+    *e.crafting_inventory += *crafting_cache.carried;
+    e.crafting_inventory->replace_liq_container_count( crafting_cache.carried_liquid_containers,
+            true );
 
-    std::map<itype_id, int> tmp_liq_list;
+    e.time = crafting_cache.time;
+    e.moves = crafting_cache.moves;
+    e.position = inv_pos;
+    e.radius = radius;
+    e.clear_path = clear_path;
+    return *e.crafting_inventory;
+}
+
+void Character::form_carried_crafting_inventory() const
+{
+    inventory &carried = *crafting_cache.carried;
+    carried.clear();
+    crafting_cache.carried_liquid_containers.clear();
     // TODO: Add a const overload of all_items_loc() that returns something like
     // vector<const_item_location> in order to get rid of the const_cast here.
     for( const item_location &it : const_cast<Character *>( this )->all_items_loc() ) {
@@ -578,36 +599,36 @@ const inventory &Character::crafting_inventory( const tripoint &src_pos, int rad
             if( !it->is_watertight_container() || it->get_quality( qual_BOIL, false ) <= 0 ) {
                 item tmp = item( it->typeId(), it->birthday() );
                 tmp.is_favorite = it->is_favorite;
-                *crafting_cache.crafting_inventory += tmp;
+                carried += tmp;
             }
             continue;
         } else if( it->is_watertight_container() ) {
             const int count = it->count_by_charges() ? it->charges : 1;
-            tmp_liq_list[it->typeId()] += count;
+            crafting_cache.carried_liquid_containers[it->typeId()] += count;
         }
-        crafting_cache.crafting_inventory->add_item( *it );
+        carried.add_item( *it );
     }
-    crafting_cache.crafting_inventory->replace_liq_container_count( tmp_liq_list, true );
 
     for( const item *i : get_pseudo_items() ) {
-        *crafting_cache.crafting_inventory += *i;
+        carried += *i;
     }
 
     if( has_trait( trait_BURROW ) || has_trait( trait_BURROWLARGE ) ) {
-        *crafting_cache.crafting_inventory += item( "pickaxe", calendar::turn );
-        *crafting_cache.crafting_inventory += item( "shovel", calendar::turn );
+        carried += item( "pickaxe", calendar::turn );
+        carried += item( "shovel", calendar::turn );
     }
 
     crafting_cache.moves = moves;
     crafting_cache.time = calendar::turn;
-    crafting_cache.position = inv_pos;
-    crafting_cache.radius = radius;
-    return *crafting_cache.crafting_inventory;
 }
 
 void Character::invalidate_crafting_inventory()
 {
     crafting_cache.time = calendar::before_time_starts;
+    // The carried part is rebuilt for the current turn and moves, which the entries may match
+    for( crafting_cache_type::entry &e : crafting_cache.entries ) {
+        e.time = calendar::before_time_starts;
+    }
 }
 
 void Character::make_craft( const recipe_id &id_to_make, int batch_size,
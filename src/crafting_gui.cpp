@@ -19,6 +19,7 @@
 #include "character.h"
 #include "color.h"
 #include "crafting.h"
+#include "crafting_inventory_summary.h"
 #include "cursesdef.h"
 #include "display.h"
 #include "flag.h"
@@ -175,13 +176,15 @@ static bool cannot_gain_skill_or_prof( const Character &player, const recipe &re
 namespace
 {
 struct availability {
-        explicit availability( const recipe *r, int batch_size = 1 ) {
+        availability( crafting_inventory_summary &inv, const recipe *r, int batch_size = 1 ) {
             rec = r;
             Character &player = get_player_character();
-            const inventory &inv = player.crafting_inventory();
-            auto all_items_filter = r->get_component_filter( recipe_filter_flags::none );
-            auto no_rotten_filter = r->get_component_filter( recipe_filter_flags::no_rotten );
-            auto no_favorite_filter = r->get_component_filter( recipe_filter_flags::no_favorite );
+            // Recipes with the same filter flags share the remembered item counts of inv
+            const recipe_filter_flags flags = r->get_component_filter_flags();
+            const auto &all_items_filter = inv.component_filter( flags );
+            const auto &no_rotten_filter = inv.component_filter( flags | recipe_filter_flags::no_rotten );
+            const auto &no_favorite_filter = inv.component_filter( flags |
+                                             recipe_filter_flags::no_favorite );
             const deduped_requirement_data &req = r->deduped_requirements();
             has_all_skills = r->skill_used.is_null() ||
                              player.get_skill_level( r->skill_used ) >= r->get_difficulty( player );
@@ -976,6 +979,7 @@ const recipe *select_crafting_recipe( int &batch_size_out, const recipe_id goto_
     const recipe_subset &available_recipes = player_character.get_available_recipes( crafting_inv,
             &helpers );
     std::map<const recipe *, availability> availability_cache;
+    crafting_inventory_summary crafting_inv_summary( crafting_inv );
 
     const std::string new_recipe_str = pgettext( "crafting gui", "NEW!" );
     const nc_color new_recipe_str_col = c_light_green;
@@ -1213,7 +1217,7 @@ const recipe *select_crafting_recipe( int &batch_size_out, const recipe_id goto_
                 current.clear();
                 for( int i = 1; i <= 50; i++ ) {
                     current.push_back( chosen );
-                    available.emplace_back( chosen, i );
+                    available.emplace_back( crafting_inv_summary, chosen, i );
                 }
             } else {
                 static_popup popup;
@@ -1266,7 +1270,7 @@ const recipe *select_crafting_recipe( int &batch_size_out, const recipe_id goto_
                 // cache recipe availability on first display
                 for( const recipe *e : current ) {
                     if( !availability_cache.count( e ) ) {
-                        availability_cache.emplace( e, availability( e ) );
+                        availability_cache.emplace( e, availability( crafting_inv_summary, e ) );
                     }
                 }
 
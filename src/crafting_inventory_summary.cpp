@@ -0,0 +1,91 @@
+#include "crafting_inventory_summary.h"
+
+#include <algorithm>
+
+#include "inventory.h"
+#include "recipe.h"
+
+crafting_inventory_summary::crafting_inventory_summary( const inventory &inv ) : inv( inv )
+{
+}
+
+const std::function<bool( const item & )> &crafting_inventory_summary::component_filter(
+    const recipe_filter_flags flags )
+{
+    auto iter = filters.find( flags );
+    if( iter == filters.end() ) {
+        iter = filters.emplace( flags, recipe::component_filter( flags ) ).first;
+    }
+    return iter->second;
+}
+
+std::pair<bool, crafting_inventory_summary::filter_key> crafting_inventory_summary::key_of(
+    const std::function<bool( const item & )> &filter ) const
+{
+    using filter_fn = bool ( * )( const item & );
+    const filter_fn *fn = filter.target<filter_fn>();
+    if( fn != nullptr && *fn == &return_true<item> ) {
+        return { true, nullptr };
+    }
+    for( const auto &e : filters ) {
+        if( &e.second == &filter ) {
+            return { true, &filter };
+        }
+    }
+    return { false, nullptr };
+}
+
+VisitResponse crafting_inventory_summary::visit_items(
+    const std::function<VisitResponse( item *, item * )> &func ) const
+{
+    return inv.visit_items( func );
+}
+
+bool crafting_inventory_summary::has_quality( const quality_id &qual, int level, int qty ) const
+{
+    // inventory already caches these
+    return inv.has_quality( qual, level, qty );
+}
+
+int crafting_inventory_summary::max_quality( const quality_id &qual ) const
+{
+    return inv.max_quality( qual );
+}
+
+int crafting_inventory_summary::charges_of( const itype_id &what, int limit,
+        const std::function<bool( const item & )> &filter,
+        const std::function<void( int )> &visitor, bool in_tools ) const
+{
+    const std::pair<bool, filter_key> key = key_of( filter );
+    if( !key.first || in_tools ) {
+        return inv.charges_of( what, limit, filter, visitor, in_tools );
+    }
+    auto iter = charges.find( { key.second, what } );
+    if( iter == charges.end() ) {
+        // Charges drawn from a UPS are reported to the visitor, so they can't be remembered
+        bool uses_ups = false;
+        const int total = inv.charges_of( what, INT_MAX, filter, [&uses_ups]( int ) {
+            uses_ups = true;
+        } );
+        iter = charges.emplace( std::make_pair( key.second, what ), uses_ups ? -1 : total ).first;
+    }
+    if( iter->second < 0 ) {
+        return inv.charges_of( what, limit, filter, visitor, in_tools );
+    }
+    return std::min( iter->second, limit );
+}
+
+int crafting_inventory_summary::amount_of( const itype_id &what, bool pseudo, int limit,
+        const std::function<bool( const item & )> &filter ) const
+{
+    const std::pair<bool, filter_key> key = key_of( filter );
+    if( !key.first ) {
+        return inv.amount_of( what, pseudo, limit, filter );
+    }
+    auto iter = amounts.find( std::make_tuple( key.second, what, pseudo ) );
+    if( iter == amounts.end() ) {
+        iter = amounts.emplace( std::make_tuple( key.second, what, pseudo ),
+                                inv.amount_of( what, pseudo, INT_MAX, filter ) ).first;
+    }
+    return std::min( iter->second, limit );
+}
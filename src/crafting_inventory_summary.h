@@ -0,0 +1,60 @@
+#pragma once
+#ifndef CATA_SRC_CRAFTING_INVENTORY_SUMMARY_H
+#define CATA_SRC_CRAFTING_INVENTORY_SUMMARY_H
+
+#include <climits>
+#include <functional>
+#include <map>
+#include <tuple>
+#include <utility>
+
+#include "type_id.h"
+#include "visitable.h"
+
+class inventory;
+class item;
+enum class recipe_filter_flags : int;
+
+/**
+ * Read-only view of a crafting inventory that lets many recipes be checked against it
+ * (see requirement_data::can_make_with_inventory) while looking each item type up only once.
+ *
+ * Item counts are remembered for queries made without a filter (`return_true`) and for
+ * queries made with one of the filters handed out by @ref component_filter, which recipes
+ * with equal component filter flags share. Any other query is passed through unchanged.
+ * The wrapped inventory must not change while this view is in use.
+ */
+class crafting_inventory_summary : public read_only_visitable
+{
+    public:
+        explicit crafting_inventory_summary( const inventory &inv );
+
+        /** Component filter for the given flags, @see recipe::get_component_filter_flags */
+        const std::function<bool( const item & )> &component_filter( recipe_filter_flags flags );
+
+        // inherited from visitable
+        VisitResponse visit_items( const std::function<VisitResponse( item *, item * )> &func ) const
+        override;
+        bool has_quality( const quality_id &qual, int level = 1, int qty = 1 ) const override;
+        int max_quality( const quality_id &qual ) const override;
+        int charges_of( const itype_id &what, int limit = INT_MAX,
+                        const std::function<bool( const item & )> &filter = return_true<item>,
+                        const std::function<void( int )> &visitor = nullptr,
+                        bool in_tools = false ) const override;
+        int amount_of( const itype_id &what, bool pseudo = true, int limit = INT_MAX,
+                       const std::function<bool( const item & )> &filter = return_true<item> ) const override;
+
+    private:
+        using filter_key = const std::function<bool( const item & )> *;
+
+        /** Key under which results for this filter are remembered, or false if they are not. */
+        std::pair<bool, filter_key> key_of( const std::function<bool( const item & )> &filter ) const;
+
+        const inventory &inv;
+        std::map<recipe_filter_flags, std::function<bool( const item & )>> filters;
+        // Full charges by filter and item type, or -1 if counting them consumes UPS charges
+        mutable std::map<std::pair<filter_key, itype_id>, int> charges;
+        mutable std::map<std::tuple<filter_key, itype_id, bool>, int> amounts;
+};
+
+#endif // CATA_SRC_CRAFTING_INVENTORY_SUMMARY_H
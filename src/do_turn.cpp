@@ -584,6 +584,14 @@ void overmap_npc_move()
     }
 }
 
+// Whether a redraw that only follows the passing of time should happen now.  Frames are
+// capped by the ACTIVITY_FRAME_RATE option, so long activities spend their time simulating
+// turns instead of drawing frames faster than anyone can look at them.
+bool simulation_frame_due()
+{
+    return ui_manager::frame_due( get_option<int>( "ACTIVITY_FRAME_RATE" ) );
+}
+
 } // namespace
 
 // MAIN GAME LOOP
@@ -695,7 +703,8 @@ bool do_turn()
                 explosion_handler::process_explosions();
                 sounds::process_sound_markers( &u );
                 if( !u.activity && g->uquit != QUIT_WATCH
-                    && ( !u.has_distant_destination() || calendar::once_every( 10_seconds ) ) ) {
+                    && ( !u.has_distant_destination() || calendar::once_every( 10_seconds ) )
+                    && ( !u.is_auto_moving() || simulation_frame_due() ) ) {
                     g->wait_popup.reset();
                     ui_manager::redraw();
                 }
@@ -803,7 +812,8 @@ bool do_turn()
     }
     g->mon_info_update();
     u.process_turn();
-    if( u.moves < 0 && get_option<bool>( "FORCE_REDRAW" ) ) {
+    if( u.moves < 0 && get_option<bool>( "FORCE_REDRAW" ) &&
+        ( !u.activity || simulation_frame_due() ) ) {
         ui_manager::redraw();
         refresh_display();
     }
@@ -835,10 +845,16 @@ bool do_turn()
         }
     }
     if( wait_redraw ) {
+        // Measured from the last redraw rather than on exact turns, so a redraw skipped while
+        // the simulation is ahead of the frame rate still happens on the next due frame
+        const time_duration since_popup_redraw = calendar::turn - g->last_wait_popup_redraw;
+        const time_duration since_map_redraw = calendar::turn - g->last_wait_map_redraw;
         if( g->first_redraw_since_waiting_started ||
-            calendar::once_every( std::min( 1_minutes, wait_refresh_rate ) ) ) {
-            if( g->first_redraw_since_waiting_started || calendar::once_every( wait_refresh_rate ) ) {
+            ( since_popup_redraw >= std::min( 1_minutes, wait_refresh_rate ) &&
+              simulation_frame_due() ) ) {
+            if( g->first_redraw_since_waiting_started || since_map_redraw >= wait_refresh_rate ) {
                 ui_manager::redraw();
+                g->last_wait_map_redraw = calendar::turn;
             }
 
             // Avoid redrawing the main UI every time due to invalidation
@@ -847,6 +863,7 @@ bool do_turn()
             g->wait_popup->on_top( true ).wait_message( "%s", wait_message );
             ui_manager::redraw();
             refresh_display();
+            g->last_wait_popup_redraw = calendar::turn;
             g->first_redraw_since_waiting_started = false;
         }
     } else {
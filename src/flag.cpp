@@ -1,6 +1,7 @@
 #include "flag.h"
 
 #include "debug.h"
+#include "flag_bitset.h"
 #include "generic_factory.h"
 #include "json.h"
 #include "type_id.h"
@@ -426,6 +427,71 @@ void json_flag::check() const
     }
 }
 
+flag_bitset::flag_bitset( const std::set<flag_id> &flags )
+{
+    for( const flag_id &flag : flags ) {
+        set( flag );
+    }
+}
+
+int flag_bitset::index_of( const flag_id &flag )
+{
+    return json_flags_all.convert( flag, int_id<json_flag>( -1 ), false ).to_i();
+}
+
+bool flag_bitset::test( const flag_id &flag ) const
+{
+    const int idx = index_of( flag );
+    if( idx < 0 ) {
+        return false;
+    }
+    if( idx < 64 ) {
+        return ( inline_bits & ( uint64_t( 1 ) << idx ) ) != 0;
+    }
+    const size_t word = idx / 64 - 1;
+    return word < extra_bits.size() &&
+           ( extra_bits[word] & ( uint64_t( 1 ) << ( idx % 64 ) ) ) != 0;
+}
+
+void flag_bitset::set( const flag_id &flag )
+{
+    const int idx = index_of( flag );
+    if( idx < 0 ) {
+        return;
+    }
+    if( idx < 64 ) {
+        inline_bits |= uint64_t( 1 ) << idx;
+        return;
+    }
+    const size_t word = idx / 64 - 1;
+    if( word >= extra_bits.size() ) {
+        extra_bits.resize( word + 1, 0 );
+    }
+    extra_bits[word] |= uint64_t( 1 ) << ( idx % 64 );
+}
+
+void flag_bitset::reset( const flag_id &flag )
+{
+    const int idx = index_of( flag );
+    if( idx < 0 ) {
+        return;
+    }
+    if( idx < 64 ) {
+        inline_bits &= ~( uint64_t( 1 ) << idx );
+        return;
+    }
+    const size_t word = idx / 64 - 1;
+    if( word < extra_bits.size() ) {
+        extra_bits[word] &= ~( uint64_t( 1 ) << ( idx % 64 ) );
+    }
+}
+
+void flag_bitset::clear()
+{
+    inline_bits = 0;
+    extra_bits.clear();
+}
+
 void json_flag::finalize_all()
 {
     json_flags_all.finalize();
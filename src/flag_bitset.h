@@ -0,0 +1,38 @@
+#pragma once
+#ifndef CATA_SRC_FLAG_BITSET_H
+#define CATA_SRC_FLAG_BITSET_H
+
+#include <cstdint>
+#include <set>
+#include <vector>
+
+#include "type_id.h"
+
+/**
+ * Compact set of flags for fast membership tests, indexed by the position of each flag in the
+ * loaded @ref json_flag list. The first 64 flags are stored inline, the remaining words are only
+ * allocated once one of those flags is set.
+ * Indices are only stable while the loaded flags are, so the bitset has to be rebuilt from the
+ * matching set of `flag_id` after flags are reloaded.
+ */
+class flag_bitset
+{
+    public:
+        flag_bitset() = default;
+        explicit flag_bitset( const std::set<flag_id> &flags );
+
+        bool test( const flag_id &flag ) const;
+        /** Invalid flags are ignored */
+        void set( const flag_id &flag );
+        void reset( const flag_id &flag );
+        void clear();
+
+    private:
+        /** Dense index of @p flag, or -1 if it is not a loaded flag */
+        static int index_of( const flag_id &flag );
+
+        uint64_t inline_bits = 0;
+        std::vector<uint64_t> extra_bits;
+};
+
+#endif // CATA_SRC_FLAG_BITSET_H
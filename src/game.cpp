@@ -11562,12 +11562,15 @@ point game::update_map( int &x, int &y, bool z_level_changed )
     // this handles loading/unloading submaps that have scrolled on or off the viewport
     // NOLINTNEXTLINE(cata-use-named-point-constants)
     inclusive_rectangle<point> size_1( point( -1, -1 ), point( 1, 1 ) );
+    const tripoint_abs_sm old_bubble_origin = m.get_abs_sub();
     point remaining_shift = shift;
     while( remaining_shift != point_zero ) {
         point this_shift = clamp( remaining_shift, size_1 );
         m.shift( this_shift );
         remaining_shift -= this_shift;
     }
+    // Uniform submaps that scrolled out of the reality bubble can be kept compactly.
+    MAPBUFFER.compact_uniform_submaps( old_bubble_origin );
 
     // Shift monsters
     shift_monsters( tripoint( shift, 0 ) );
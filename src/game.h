@@ -1130,6 +1130,9 @@ class game
         bool critter_died = false; // NOLINT(cata-serialize)
         /** Is this the first redraw since waiting (sleeping or activity) started */
         bool first_redraw_since_waiting_started = true; // NOLINT(cata-serialize)
+        /** When the main UI and the wait popup were last redrawn while waiting */
+        time_point last_wait_map_redraw; // NOLINT(cata-serialize)
+        time_point last_wait_popup_redraw; // NOLINT(cata-serialize)
         /** Is Zone manager open or not - changes graphics of some zone tiles */
         bool zones_manager_open = false; // NOLINT(cata-serialize)
 
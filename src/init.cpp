@@ -755,6 +755,7 @@ void DynamicDataLoader::finalize_loaded_data( loading_ui &ui )
 
     check_consistency( ui );
     finalized = true;
+    data_generation++;
 }
 
 void DynamicDataLoader::check_consistency( loading_ui &ui )
@@ -70,6 +70,7 @@ class DynamicDataLoader
 
     private:
         bool finalized = false;
+        int data_generation = 0;
 
         struct cached_streams;
 
@@ -171,6 +172,14 @@ class DynamicDataLoader
             return finalized;
         }
 
+        /**
+         * Changes every time the data is finalized, so caches derived from the loaded data can
+         * tell that they are stale.
+         */
+        int get_data_generation() const {
+            return data_generation;
+        }
+
         /**
          * Get a possibly cached stream for deferred data loading. If the cached
          * stream is still in use by outside code, this returns a new stream to
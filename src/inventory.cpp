@@ -519,17 +519,19 @@ void inventory::form_from_map( map &m, std::vector<tripoint> pts, const Characte
                 const bool using_ammotype = f.has_flag( ter_furn_flag::TFLAG_AMMOTYPE_RELOAD );
                 int amount = 0;
                 itype_id ammo_id = ammo->get_id();
-                // Some furniture can consume more than one item type.
-                if( using_ammotype ) {
-                    amount = count_charges_in_list( &ammo->ammo->type, m.i_at( p ), ammo_id );
-                } else {
-                    amount = count_charges_in_list( ammo, m.i_at( p ) );
+                if( m.has_items( p ) ) {
+                    // Some furniture can consume more than one item type.
+                    if( using_ammotype ) {
+                        amount = count_charges_in_list( &ammo->ammo->type, m.i_at( p ), ammo_id );
+                    } else {
+                        amount = count_charges_in_list( ammo, m.i_at( p ) );
+                    }
                 }
                 item furn_ammo( ammo_id, calendar::turn, amount );
                 furn_item->put_in( furn_ammo, item_pocket::pocket_type::MAGAZINE );
             }
         }
-        if( m.accessible_items( p ) ) {
+        if( m.has_items( p ) && m.accessible_items( p ) ) {
             for( item &i : m.i_at( p ) ) {
                 // if it's *the* player requesting this from from map inventory
                 // then don't allow items owned by another faction to be factored into recipe components etc.
@@ -558,7 +560,7 @@ void inventory::form_from_map( map &m, std::vector<tripoint> pts, const Characte
         }
 
         // keg-kludge
-        if( m.furn( p )->has_examine( iexamine::keg ) ) {
+        if( m.has_items( p ) && m.furn( p )->has_examine( iexamine::keg ) ) {
             map_stack liq_contained = m.i_at( p );
             for( item &i : liq_contained ) {
                 if( i.made_of( phase_id::LIQUID ) ) {
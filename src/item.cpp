@@ -1359,7 +1359,7 @@ bool item::stacks_with( const item &rhs, bool check_components, bool combine_liq
     // Guns that differ only by dirt/shot_counter can still stack,
     // but other item_vars such as label/note will prevent stacking
     const std::vector<std::string> ignore_keys = { "dirt", "shot_counter", "spawn_location_omt" };
-    if( map_without_keys( item_vars, ignore_keys ) != map_without_keys( rhs.item_vars, ignore_keys ) ) {
+    if( !item_vars.equal_except( rhs.item_vars, ignore_keys ) ) {
         return false;
     }
     const std::string omt_loc_var = "spawn_location_omt";
@@ -1514,67 +1514,41 @@ void item::force_insert_item( const item &it, item_pocket::pocket_type pk_type )
 
 void item::set_var( const std::string &name, const int value )
 {
-    std::ostringstream tmpstream;
-    tmpstream.imbue( std::locale::classic() );
-    tmpstream << value;
-    item_vars[name] = tmpstream.str();
+    item_vars.set( name, static_cast<int64_t>( value ) );
 }
 
 void item::set_var( const std::string &name, const long long value )
 {
-    std::ostringstream tmpstream;
-    tmpstream.imbue( std::locale::classic() );
-    tmpstream << value;
-    item_vars[name] = tmpstream.str();
+    item_vars.set( name, static_cast<int64_t>( value ) );
 }
 
 // NOLINTNEXTLINE(cata-no-long)
 void item::set_var( const std::string &name, const long value )
 {
-    std::ostringstream tmpstream;
-    tmpstream.imbue( std::locale::classic() );
-    tmpstream << value;
-    item_vars[name] = tmpstream.str();
+    item_vars.set( name, static_cast<int64_t>( value ) );
 }
 
 void item::set_var( const std::string &name, const double value )
 {
-    item_vars[name] = string_format( "%f", value );
+    item_vars.set( name, value );
 }
 
 double item::get_var( const std::string &name, const double default_value ) const
 {
-    const auto it = item_vars.find( name );
-    if( it == item_vars.end() ) {
-        return default_value;
-    }
-    const std::string &val = it->second;
-    char *end;
-    errno = 0;
-    double result = strtod( &val[0], &end );
-    if( errno != 0 ) {
-        debugmsg( "Error parsing floating point value from %s in item::get_var: %s",
-                  val, strerror( errno ) );
-        return default_value;
-    }
-    if( end != &val[0] + val.size() ) {
-        debugmsg( "Stray characters at end of floating point value %s in item::get_var", val );
-    }
-    return result;
+    return item_vars.get( name, default_value );
 }
 
 void item::set_var( const std::string &name, const tripoint &value )
 {
-    item_vars[name] = string_format( "%d,%d,%d", value.x, value.y, value.z );
+    item_vars.set( name, string_format( "%d,%d,%d", value.x, value.y, value.z ) );
 }
 
 tripoint item::get_var( const std::string &name, const tripoint &default_value ) const
 {
-    const auto it = item_vars.find( name );
-    if( it == item_vars.end() ) {
+    if( !item_vars.has( name ) ) {
         return default_value;
     }
-    std::vector<std::string> values = string_split( it->second, ',' );
+    std::vector<std::string> values = string_split( item_vars.get( name, "" ), ',' );
     cata_assert( values.size() == 3 );
     auto convert_or_error = []( const std::string & s ) {
         ret_val<int> result = try_parse_integer<int>( s, false );
@@ -1592,16 +1566,12 @@ tripoint item::get_var( const std::string &name, const tripoint &default_value )
 
 void item::set_var( const std::string &name, const std::string &value )
 {
-    item_vars[name] = value;
+    item_vars.set( name, value );
 }
 
 std::string item::get_var( const std::string &name, const std::string &default_value ) const
 {
-    const auto it = item_vars.find( name );
-    if( it == item_vars.end() ) {
-        return default_value;
-    }
-    return it->second;
+    return item_vars.get( name, default_value );
 }
 
 std::string item::get_var( const std::string &name ) const
@@ -1611,7 +1581,7 @@ std::string item::get_var( const std::string &name ) const
 
 bool item::has_var( const std::string &name ) const
 {
-    return item_vars.count( name ) > 0;
+    return item_vars.has( name );
 }
 
 void item::erase_var( const std::string &name )
@@ -2097,8 +2067,6 @@ void item::basic_info( std::vector<iteminfo> &info, const iteminfo_query *parts,
 
     if( parts->test( iteminfo_parts::DESCRIPTION ) ) {
         insert_separation_line( info );
-        const std::map<std::string, std::string>::const_iterator idescription =
-            item_vars.find( "description" );
         const cata::optional<translation> snippet = SNIPPET.get_snippet_by_id( snip_id );
         if( snippet.has_value() ) {
             // Just use the dynamic description
@@ -2117,8 +2085,8 @@ void item::basic_info( std::vector<iteminfo> &info, const iteminfo_query *parts,
                 //note that you have seen the snippet
                 get_avatar().add_snippet( snip_id );
             }
-        } else if( idescription != item_vars.end() ) {
-            info.emplace_back( "DESCRIPTION", idescription->second );
+        } else if( has_var( "description" ) ) {
+            info.emplace_back( "DESCRIPTION", get_var( "description" ) );
         } else if( has_itype_variant() ) {
             // append the description instead of fully overwriting it
             if( itype_variant().append ) {
@@ -2221,7 +2189,7 @@ void item::debug_info( std::vector<iteminfo> &info, const iteminfo_query *parts,
             }, enumeration_conjunction::none );
 
             info.emplace_back( "BASE", string_format( _( "flags: %s" ), flags_listed ) );
-            for( auto const &imap : item_vars ) {
+            for( auto const &imap : item_vars.as_strings() ) {
                 info.emplace_back( "BASE",
                                    string_format( _( "item var: %s, %s" ), imap.first,
                                                   imap.second ) );
@@ -5454,27 +5422,24 @@ void item::final_info( std::vector<iteminfo> &info, const iteminfo_query *parts,
         }
     }
 
-    std::map<std::string, std::string>::const_iterator item_note = item_vars.find( "item_note" );
-
-    if( item_note != item_vars.end() && parts->test( iteminfo_parts::DESCRIPTION_NOTES ) ) {
+    if( has_var( "item_note" ) && parts->test( iteminfo_parts::DESCRIPTION_NOTES ) ) {
         insert_separation_line( info );
+        const std::string item_note = get_var( "item_note" );
         std::string ntext;
-        std::map<std::string, std::string>::const_iterator item_note_tool =
-            item_vars.find( "item_note_tool" );
         const use_function *use_func =
-            item_note_tool != item_vars.end() ?
+            has_var( "item_note_tool" ) ?
             item_controller->find_template(
-                itype_id( item_note_tool->second ) )->get_use( "inscribe" ) :
+                itype_id( get_var( "item_note_tool" ) ) )->get_use( "inscribe" ) :
             nullptr;
         const inscribe_actor *use_actor =
             use_func ? dynamic_cast<const inscribe_actor *>( use_func->get_actor_ptr() ) : nullptr;
         if( use_actor ) {
             //~ %1$s: gerund (e.g. carved), %2$s: item name, %3$s: inscription text
             ntext = string_format( pgettext( "carving", "%1$s on the %2$s is: %3$s" ),
-                                   use_actor->gerund, tname(), item_note->second );
+                                   use_actor->gerund, tname(), item_note );
         } else {
             //~ %1$s: inscription text
-            ntext = string_format( pgettext( "carving", "Note: %1$s" ), item_note->second );
+            ntext = string_format( pgettext( "carving", "Note: %1$s" ), item_note );
         }
         info.emplace_back( "DESCRIPTION", ntext );
     }
@@ -6310,7 +6275,7 @@ std::string item::tname( unsigned int quantity, bool with_prefix, unsigned int t
     std::string maintext;
     std::string contents_suffix_text;
 
-    if( is_corpse() || typeId() == itype_blood || item_vars.find( "name" ) != item_vars.end() ) {
+    if( is_corpse() || typeId() == itype_blood || has_var( "name" ) ) {
         maintext = type_name( quantity );
     } else if( ( is_gun() || is_tool() || is_magazine() ) && !is_power_armor() ) {
         int amt = 0;
@@ -6542,7 +6507,7 @@ std::string item::tname( unsigned int quantity, bool with_prefix, unsigned int t
         ret = utf8_truncate( ret, truncate + truncate_override );
     }
 
-    if( item_vars.find( "item_note" ) != item_vars.end() ) {
+    if( has_var( "item_note" ) ) {
         //~ %s is an item name. This style is used to denote items with notes.
         return string_format( _( "*%s*" ), ret );
     } else {
@@ -6795,11 +6760,11 @@ units::mass item::weight( bool include_contents, bool integral ) const
     }
 
     units::mass ret;
-    std::string local_str_mass = integral ? get_var( "integral_weight" ) : get_var( "weight" );
-    if( local_str_mass.empty() ) {
+    const double local_mass = get_var( integral ? "integral_weight" : "weight", -1.0 );
+    if( local_mass < 0 ) {
         ret = integral ? type->integral_weight : type->weight;
     } else {
-        ret = units::from_milligram( std::stoll( local_str_mass ) );
+        ret = units::from_milligram( static_cast<int64_t>( local_mass ) );
     }
 
     if( has_flag( flag_REDUCED_WEIGHT ) ) {
@@ -7206,6 +7171,7 @@ int item::current_reach_range( const Character &guy ) const
 void item::unset_flags()
 {
     item_tags.clear();
+    item_tag_bits.clear();
     requires_tags_processing = true;
 }
 
@@ -7226,7 +7192,7 @@ bool item::has_fault_flag( const std::string &searched_flag ) const
 
 bool item::has_own_flag( const flag_id &f ) const
 {
-    return item_tags.count( f );
+    return item_tag_bits.test( f );
 }
 
 bool item::has_flag( const flag_id &f, bool ignore_inherit ) const
@@ -7237,25 +7203,26 @@ bool item::has_flag( const flag_id &f, bool ignore_inherit ) const
         return false;
     }
 
+    // The checks below walk the pockets in place rather than collecting the mods and pockets
+    // into temporary containers, this is called far too often to allocate every time.
     if( !ignore_inherit && f->inherit() ) {
-        for( const item *e : is_gun() ? gunmods() : toolmods() ) {
+        const bool gun = is_gun();
+        const auto mod_has_f = [gun, &f]( const item & e ) {
             // gunmods fired separately do not contribute to base gun flags
-            if( !e->is_gun() && e->has_flag( f ) ) {
-                return true;
-            }
+            return ( gun ? e.is_gunmod() : e.is_toolmod() ) && !e.is_gun() && e.has_flag( f );
+        };
+        if( ( gun || is_tool() ) &&
+            contents.has_any_with( mod_has_f, item_pocket::pocket_type::MOD ) ) {
+            return true;
         }
     }
 
     // check flags from items in inherit pockets
-    for( const item_pocket *pocket : contents.get_all_contained_pockets() ) {
-        // if the pocket inherits flags
-        if( pocket->inherits_flags() ) {
-            for( const item *e : pocket->all_items_top() ) {
-                if( e->has_flag( f ) ) {
-                    return true;
-                }
-            }
-        }
+    const auto has_f = [&f]( const item & e ) {
+        return e.has_flag( f );
+    };
+    if( contents.has_any_inherited_with( has_f ) ) {
+        return true;
     }
 
     // other item type flags
@@ -7273,6 +7240,7 @@ item &item::set_flag( const flag_id &flag )
 {
     if( flag.is_valid() ) {
         item_tags.insert( flag );
+        item_tag_bits.set( flag );
         requires_tags_processing = true;
     } else {
         debugmsg( "Attempted to set invalid flag_id %s", flag.str() );
@@ -7283,6 +7251,7 @@ item &item::set_flag( const flag_id &flag )
 item &item::unset_flag( const flag_id &flag )
 {
     item_tags.erase( flag );
+    item_tag_bits.reset( flag );
     requires_tags_processing = true;
     return *this;
 }
@@ -12316,26 +12285,26 @@ bool item_compare_by_charges( const item &left, const item &right )
 static const std::string USED_BY_IDS( "USED_BY_IDS" );
 bool item::already_used_by_player( const Character &p ) const
 {
-    const auto it = item_vars.find( USED_BY_IDS );
-    if( it == item_vars.end() ) {
+    if( !has_var( USED_BY_IDS ) ) {
         return false;
     }
     // USED_BY_IDS always starts *and* ends with a ';', the search string
     // ';<id>;' matches at most one part of USED_BY_IDS, and only when exactly that
     // id has been added.
     const std::string needle = string_format( ";%d;", p.getID().get_value() );
-    return it->second.find( needle ) != std::string::npos;
+    return get_var( USED_BY_IDS ).find( needle ) != std::string::npos;
 }
 
 void item::mark_as_used_by_player( const Character &p )
 {
-    std::string &used_by_ids = item_vars[ USED_BY_IDS ];
+    std::string used_by_ids = get_var( USED_BY_IDS );
     if( used_by_ids.empty() ) {
         // *always* start with a ';'
         used_by_ids = ";";
     }
     // and always end with a ';'
     used_by_ids += string_format( "%d;", p.getID().get_value() );
+    set_var( USED_BY_IDS, used_by_ids );
 }
 
 bool item::can_holster( const item &obj, bool ) const
@@ -13652,7 +13621,6 @@ bool item::is_reloadable() const
 
 std::string item::type_name( unsigned int quantity ) const
 {
-    const auto iter = item_vars.find( "name" );
     std::string ret_name;
     if( typeId() == itype_blood ) {
         if( corpse == nullptr || corpse->id.is_null() ) {
@@ -13662,8 +13630,8 @@ std::string item::type_name( unsigned int quantity ) const
                                              "%s blood",  quantity ),
                                   corpse->nname() );
         }
-    } else if( iter != item_vars.end() ) {
-        return iter->second;
+    } else if( has_var( "name" ) ) {
+        return get_var( "name" );
     } else if( has_itype_variant() ) {
         ret_name = itype_variant().alt_name.translated();
     } else {
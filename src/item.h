@@ -19,11 +19,13 @@
 #include "cata_utility.h"
 #include "compatibility.h"
 #include "enums.h"
+#include "flag_bitset.h"
 #include "gun_mode.h"
 #include "io_tags.h"
 #include "item_contents.h"
 #include "item_location.h"
 #include "item_pocket.h"
+#include "item_var_store.h"
 #include "material.h"
 #include "optional.h"
 #include "requirements.h"
@@ -1734,6 +1736,8 @@ class item : public visitable
          * The get_var function return the value (if the variable exists), or the default value
          * otherwise.  The type of the default value determines which get_var function is used.
          * All numeric values are returned as doubles and may be cast to the desired type.
+         * Numbers are stored as numbers (see @ref item_var_store) and only turned into text
+         * when read as a string or saved.
          * <code>
          * int v = itm.get_var("v", 0); // v will be an int
          * double d = itm.get_var("v", 0.0); // d will be a double
@@ -2817,8 +2821,9 @@ class item : public visitable
          */
         bool requires_tags_processing = true;
         FlagsSetType item_tags; // generic item specific flags
+        flag_bitset item_tag_bits; // same as item_tags, for has_own_flag
         safe_reference_anchor anchor;
-        std::map<std::string, std::string> item_vars;
+        item_var_store item_vars;
         const mtype *corpse = nullptr;
         std::string corpse_name;       // Name of the late lamented
         std::set<matec_id> techniques; // item specific techniques
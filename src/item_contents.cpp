@@ -1313,6 +1313,18 @@ bool item_contents::has_any_with( const std::function<bool( const item &it )> &f
     return false;
 }
 
+bool item_contents::has_any_inherited_with( const std::function<bool( const item & )> &filter )
+const
+{
+    for( const item_pocket &pocket : contents ) {
+        if( pocket.is_type( item_pocket::pocket_type::CONTAINER ) && pocket.inherits_flags() &&
+            pocket.has_any_with( filter ) ) {
+            return true;
+        }
+    }
+    return false;
+}
+
 bool item_contents::stacks_with( const item_contents &rhs ) const
 {
     if( contents.size() != rhs.contents.size() ) {
@@ -310,6 +310,8 @@ class item_contents
         bool has_unrestricted_pockets() const;
         bool has_any_with( const std::function<bool( const item & )> &filter,
                            item_pocket::pocket_type pk_type ) const;
+        // whether any item in a container pocket that passes its flags on to the parent matches
+        bool has_any_inherited_with( const std::function<bool( const item & )> &filter ) const;
 
         /**
          * Is part of the recursive call of item::process. see that function for additional comments
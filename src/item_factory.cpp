@@ -30,6 +30,7 @@
 #include "enums.h"
 #include "explosion.h"
 #include "flag.h"
+#include "flag_bitset.h"
 #include "flat_set.h"
 #include "game_constants.h"
 #include "generic_factory.h"
@@ -208,6 +209,9 @@ static bool is_physical( const itype &type )
 
 void Item_factory::finalize_pre( itype &obj )
 {
+    // flags may still change until finalize_post
+    obj.item_tag_bits_valid = false;
+
     // TODO: separate repairing from reinforcing/enhancement
     if( obj.damage_max() == obj.damage_min() ) {
         obj.item_tags.insert( flag_NO_REPAIR );
@@ -628,6 +632,8 @@ void Item_factory::finalize_post( itype &obj )
         }
         return false;
     } );
+    obj.item_tag_bits = flag_bitset( obj.item_tags );
+    obj.item_tag_bits_valid = true;
 
     // handle complex firearms as a special case
     if( obj.gun && !obj.has_flag( flag_PRIMITIVE_RANGED_WEAPON ) ) {
@@ -189,7 +189,7 @@ item Single_item_creator::create_single( const time_point &birthday, RecursionLi
         tmp.set_flag( flag_FIT );
     }
     if( modifier ) {
-        modifier->modify( tmp, "modifier for " + context() );
+        modifier->modify( tmp, context() );
     } else {
         int qty = tmp.charges;
         if( modifier ) {
@@ -251,7 +251,7 @@ std::size_t Single_item_creator::create( ItemList &list,
             rec.pop_back();
             if( modifier ) {
                 for( auto it = list.end() - tmp_list_size; it != list.end(); ++it ) {
-                    modifier->modify( *it, "modifier for " + context() );
+                    modifier->modify( *it, context() );
                 }
             }
         }
@@ -485,7 +485,8 @@ void Item_modifier::modify( item &new_item, const std::string &context ) const
             } else if( new_item.is_magazine() ) {
                 new_item.ammo_set( new_item.ammo_default(), ch );
             } else {
-                debugmsg( "in %s: tried to set ammo for %s which does not have ammo or a magazine",
+                debugmsg( "in modifier for %s: tried to set ammo for %s which does not have ammo or a "
+                          "magazine",
                           context, new_item.typeId().str() );
             }
         } else if( new_item.type->can_have_charges() ) {
@@ -689,6 +690,7 @@ void Item_group::add_entry( std::unique_ptr<Item_spawn_data> ptr )
         sic->inherit_ammo_mag_chances( with_ammo, with_magazine );
     }
     items.push_back( std::move( ptr ) );
+    cumulative_prob.push_back( sum_prob );
 }
 
 std::size_t Item_group::create( Item_spawn_data::ItemList &list,
@@ -703,17 +705,8 @@ std::size_t Item_group::create( Item_spawn_data::ItemList &list,
             elem->create( list, birthday, rec, flags );
         }
     } else if( type == G_DISTRIBUTION ) {
-        int p = rng( 0, sum_prob - 1 );
-        for( const auto &elem : items ) {
-            bool ev_based = elem->is_event_based();
-            int prob = elem->get_probability( false );
-            int real_prob = elem->get_probability( true );
-            p -= real_prob;
-            if( ( ev_based && prob == 0 ) || p >= 0 ) {
-                continue;
-            }
+        if( const Item_spawn_data *elem = pick_distribution_entry() ) {
             elem->create( list, birthday, rec, flags );
-            break;
         }
     }
     const std::size_t items_created = list.size() - prev_list_size;
@@ -731,21 +724,29 @@ item Item_group::create_single( const time_point &birthday, RecursionList &rec )
             return elem->create_single( birthday, rec );
         }
     } else if( type == G_DISTRIBUTION ) {
-        int p = rng( 0, sum_prob - 1 );
-        for( const auto &elem : items ) {
-            bool ev_based = elem->is_event_based();
-            int prob = elem->get_probability( false );
-            int real_prob = elem->get_probability( true );
-            p -= real_prob;
-            if( ( ev_based && prob == 0 ) || p >= 0 ) {
-                continue;
-            }
+        if( const Item_spawn_data *elem = pick_distribution_entry() ) {
             return elem->create_single( birthday, rec );
         }
     }
     return item( null_item_id, birthday );
 }
 
+const Item_spawn_data *Item_group::pick_distribution_entry() const
+{
+    const int p = rng( 0, sum_prob - 1 );
+    // the first entry whose running total exceeds the draw
+    const auto first = std::upper_bound( cumulative_prob.begin(), cumulative_prob.end(), p );
+    for( auto i = static_cast<size_t>( first - cumulative_prob.begin() ); i < items.size(); ++i ) {
+        const Item_spawn_data &elem = *items[i];
+        // event based entries outside of their event pass the spawn on to the next entry
+        if( elem.is_event_based() && elem.get_probability( false ) == 0 ) {
+            continue;
+        }
+        return &elem;
+    }
+    return nullptr;
+}
+
 void Item_group::check_consistency() const
 {
     for( const auto &elem : items ) {
@@ -791,6 +792,12 @@ bool Item_group::remove_item( const itype_id &itemid )
             ++a;
         }
     }
+    cumulative_prob.clear();
+    int total = 0;
+    for( const std::unique_ptr<Item_spawn_data> &elem : items ) {
+        total += elem->get_probability( true );
+        cumulative_prob.push_back( total );
+    }
     return items.empty();
 }
 
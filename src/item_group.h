@@ -398,6 +398,17 @@ class Item_group : public Item_spawn_data
          * that this group contains.
          */
         int sum_prob;
+        /**
+         * Running total of the probabilities of @ref items, so that the entry of a
+         * G_DISTRIBUTION group can be found by binary search.
+         */
+        std::vector<int> cumulative_prob;
+        /**
+         * Picks the entry of a G_DISTRIBUTION group to spawn, or nullptr if there is none.
+         * Gives the same result for the same random draw as subtracting the probabilities of
+         * the entries one by one.
+         */
+        const Item_spawn_data *pick_distribution_entry() const;
         /**
          * Links to the entries in this group.
          */
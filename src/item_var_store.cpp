@@ -0,0 +1,236 @@
+#include "item_var_store.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+#include "debug.h"
+#include "json.h"
+#include "string_formatter.h"
+
+static bool parse_integer( const std::string &text, int64_t &result )
+{
+    if( text.empty() ) {
+        return false;
+    }
+    char *end;
+    errno = 0;
+    const long long value = std::strtoll( text.c_str(), &end, 10 );
+    // Only accept the exact text std::to_string would give back, so saving is lossless
+    if( errno != 0 || end != text.c_str() + text.size() || std::to_string( value ) != text ) {
+        return false;
+    }
+    result = value;
+    return true;
+}
+
+static bool parse_floating( const std::string &text, double &result )
+{
+    if( text.empty() ) {
+        return false;
+    }
+    char *end;
+    errno = 0;
+    const double value = std::strtod( text.c_str(), &end );
+    if( errno != 0 || end != text.c_str() + text.size() || string_format( "%f", value ) != text ) {
+        return false;
+    }
+    result = value;
+    return true;
+}
+
+std::string item_var_store::var::to_string() const
+{
+    switch( type ) {
+        case kind::integer:
+            return std::to_string( integer );
+        case kind::floating:
+            return string_format( "%f", floating );
+        case kind::text:
+            break;
+    }
+    return text;
+}
+
+bool item_var_store::var::same_value( const var &rhs ) const
+{
+    if( type == kind::integer && rhs.type == kind::integer ) {
+        return integer == rhs.integer;
+    }
+    if( type == kind::text && rhs.type == kind::text ) {
+        return text == rhs.text;
+    }
+    // doubles are compared in their saved form, as they were before numbers were stored typed
+    return to_string() == rhs.to_string();
+}
+
+std::vector<item_var_store::var>::const_iterator item_var_store::find(
+    const std::string &name ) const
+{
+    const auto it = std::lower_bound( vars.begin(), vars.end(), name,
+    []( const var & v, const std::string & n ) {
+        return v.name < n;
+    } );
+    if( it == vars.end() || it->name != name ) {
+        return vars.end();
+    }
+    return it;
+}
+
+item_var_store::var &item_var_store::emplace( const std::string &name )
+{
+    auto it = std::lower_bound( vars.begin(), vars.end(), name,
+    []( const var & v, const std::string & n ) {
+        return v.name < n;
+    } );
+    if( it == vars.end() || it->name != name ) {
+        it = vars.emplace( it );
+        it->name = name;
+    }
+    return *it;
+}
+
+bool item_var_store::has( const std::string &name ) const
+{
+    return find( name ) != vars.end();
+}
+
+void item_var_store::erase( const std::string &name )
+{
+    const auto it = find( name );
+    if( it != vars.end() ) {
+        vars.erase( it );
+    }
+}
+
+void item_var_store::erase_prefixed( const std::string &prefix )
+{
+    vars.erase( std::remove_if( vars.begin(), vars.end(), [&prefix]( const var & v ) {
+        return v.name.compare( 0, prefix.size(), prefix ) == 0;
+    } ), vars.end() );
+}
+
+void item_var_store::set( const std::string &name, const int64_t value )
+{
+    var &v = emplace( name );
+    v.type = var::kind::integer;
+    v.integer = value;
+    v.text.clear();
+}
+
+void item_var_store::set( const std::string &name, const double value )
+{
+    var &v = emplace( name );
+    v.type = var::kind::floating;
+    v.floating = value;
+    v.text.clear();
+}
+
+void item_var_store::set( const std::string &name, const std::string &value )
+{
+    var &v = emplace( name );
+    v.type = var::kind::text;
+    v.text = value;
+}
+
+double item_var_store::get( const std::string &name, const double default_value ) const
+{
+    const auto it = find( name );
+    if( it == vars.end() ) {
+        return default_value;
+    }
+    switch( it->type ) {
+        case var::kind::integer:
+            return static_cast<double>( it->integer );
+        case var::kind::floating:
+            return it->floating;
+        case var::kind::text:
+            break;
+    }
+    const std::string &val = it->text;
+    char *end;
+    errno = 0;
+    double result = strtod( &val[0], &end );
+    if( errno != 0 ) {
+        debugmsg( "Error parsing floating point value from %s in item::get_var: %s",
+                  val, strerror( errno ) );
+        return default_value;
+    }
+    if( end != &val[0] + val.size() ) {
+        debugmsg( "Stray characters at end of floating point value %s in item::get_var", val );
+    }
+    return result;
+}
+
+std::string item_var_store::get( const std::string &name,
+                                 const std::string &default_value ) const
+{
+    const auto it = find( name );
+    if( it == vars.end() ) {
+        return default_value;
+    }
+    return it->to_string();
+}
+
+std::vector<std::pair<std::string, std::string>> item_var_store::as_strings() const
+{
+    std::vector<std::pair<std::string, std::string>> ret;
+    ret.reserve( vars.size() );
+    for( const var &v : vars ) {
+        ret.emplace_back( v.name, v.to_string() );
+    }
+    return ret;
+}
+
+bool item_var_store::equal_except( const item_var_store &rhs,
+                                   const std::vector<std::string> &ignored ) const
+{
+    const auto is_ignored = [&ignored]( const var & v ) {
+        return std::find( ignored.begin(), ignored.end(), v.name ) != ignored.end();
+    };
+    auto lhs_it = vars.begin();
+    auto rhs_it = rhs.vars.begin();
+    while( true ) {
+        while( lhs_it != vars.end() && is_ignored( *lhs_it ) ) {
+            ++lhs_it;
+        }
+        while( rhs_it != rhs.vars.end() && is_ignored( *rhs_it ) ) {
+            ++rhs_it;
+        }
+        if( lhs_it == vars.end() || rhs_it == rhs.vars.end() ) {
+            return lhs_it == vars.end() && rhs_it == rhs.vars.end();
+        }
+        if( lhs_it->name != rhs_it->name || !lhs_it->same_value( *rhs_it ) ) {
+            return false;
+        }
+        ++lhs_it;
+        ++rhs_it;
+    }
+}
+
+void item_var_store::serialize( JsonOut &json ) const
+{
+    json.start_object();
+    for( const var &v : vars ) {
+        json.member( v.name, v.to_string() );
+    }
+    json.end_object();
+}
+
+void item_var_store::deserialize( const JsonObject &jo )
+{
+    vars.clear();
+    for( const JsonMember &member : jo ) {
+        const std::string text = member.get_string();
+        int64_t integer;
+        double floating;
+        if( parse_integer( text, integer ) ) {
+            set( member.name(), integer );
+        } else if( parse_floating( text, floating ) ) {
+            set( member.name(), floating );
+        } else {
+            set( member.name(), text );
+        }
+    }
+}
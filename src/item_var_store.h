@@ -0,0 +1,82 @@
+#pragma once
+#ifndef CATA_SRC_ITEM_VAR_STORE_H
+#define CATA_SRC_ITEM_VAR_STORE_H
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+class JsonObject;
+class JsonOut;
+
+/**
+ * Storage behind the item::get_var / item::set_var API.
+ *
+ * Variables are kept in a flat vector sorted by name. Numbers are stored as numbers, so reading
+ * them back does not need to parse a string, and are only converted to text when a string is
+ * requested, when comparing against a text value and when saving. The text form is the same one
+ * the old string map stored, so saves are unchanged. Text loaded from a save that round-trips
+ * exactly through one of the numeric formats is stored as that number.
+ */
+class item_var_store
+{
+    public:
+        bool empty() const {
+            return vars.empty();
+        }
+        void clear() {
+            vars.clear();
+        }
+
+        bool has( const std::string &name ) const;
+        void erase( const std::string &name );
+        /** Removes all variables whose name starts with @p prefix */
+        void erase_prefixed( const std::string &prefix );
+
+        void set( const std::string &name, int64_t value );
+        void set( const std::string &name, double value );
+        void set( const std::string &name, const std::string &value );
+
+        /** Numeric value of the variable, text values are parsed */
+        double get( const std::string &name, double default_value ) const;
+        /** Value of the variable in the same text form it is saved as */
+        std::string get( const std::string &name, const std::string &default_value ) const;
+
+        /** All variables as name / text pairs, sorted by name */
+        std::vector<std::pair<std::string, std::string>> as_strings() const;
+
+        /** Whether both stores hold the same values, disregarding the variables in @p ignored */
+        bool equal_except( const item_var_store &rhs, const std::vector<std::string> &ignored ) const;
+
+        void serialize( JsonOut &json ) const;
+        void deserialize( const JsonObject &jo );
+
+    private:
+        struct var {
+            enum class kind : uint8_t {
+                integer,
+                floating,
+                text
+            };
+
+            std::string name;
+            kind type = kind::text;
+            union {
+                int64_t integer = 0;
+                double floating;
+            };
+            std::string text;
+
+            std::string to_string() const;
+            bool same_value( const var &rhs ) const;
+        };
+
+        std::vector<var>::const_iterator find( const std::string &name ) const;
+        /** Variable with the given name, inserted at its sorted position if missing */
+        var &emplace( const std::string &name );
+
+        std::vector<var> vars;
+};
+
+#endif // CATA_SRC_ITEM_VAR_STORE_H
@@ -123,6 +123,9 @@ bool itype::has_use() const
 
 bool itype::has_flag( const flag_id &flag ) const
 {
+    if( item_tag_bits_valid ) {
+        return item_tag_bits.test( flag );
+    }
     return item_tags.count( flag );
 }
 
@@ -18,6 +18,7 @@
 #include "damage.h"
 #include "enums.h" // point
 #include "explosion.h"
+#include "flag_bitset.h"
 #include "game_constants.h"
 #include "item_pocket.h"
 #include "iuse.h" // use_function
@@ -1219,6 +1220,9 @@ struct itype {
 
     private:
         FlagsSetType item_tags;
+        /** Same flags as @ref item_tags, filled in by Item_factory::finalize_post */
+        flag_bitset item_tag_bits;
+        bool item_tag_bits_valid = false;
 
     public:
         // How should the item explode
@@ -10025,7 +10025,7 @@ cata::optional<int> iuse::binder_add_recipe( Character *p, item *binder, bool, c
         return cata::nullopt;
     }
 
-    const inventory crafting_inv = p->crafting_inventory();
+    const inventory &crafting_inv = p->crafting_inventory();
     const std::vector<const item *> writing_tools = crafting_inv.items_with( [&]( const item & it ) {
         return it.has_flag( flag_WRITE_MESSAGE ) && it.ammo_remaining() >= it.ammo_required() ;
     } );
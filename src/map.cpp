@@ -11,6 +11,7 @@
 #include <string>
 #include <type_traits>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 
 #include "active_item_cache.h"
@@ -163,12 +164,7 @@ void map_stack::insert( const item &newitem )
 
 units::volume map_stack::max_volume() const
 {
-    if( !myorigin->inbounds( location ) ) {
-        return 0_ml;
-    } else if( myorigin->has_furn( location ) ) {
-        return myorigin->furn( location ).obj().max_volume;
-    }
-    return myorigin->ter( location ).obj().max_volume;
+    return myorigin->max_volume( location );
 }
 
 // Map class methods.
@@ -1750,7 +1746,7 @@ uint8_t map::get_known_connections( const tripoint &p, int connect_group,
     if( use_tiles ) {
         is_memorized =
         [&]( const tripoint & q ) {
-            return !player_character.get_memorized_tile( getabs( q ) ).tile.empty();
+            return !player_character.get_memorized_tile( getabs( q ) ).get_id().empty();
         };
     } else {
 #endif
@@ -1801,7 +1797,7 @@ uint8_t map::get_known_connections_f( const tripoint &p, int connect_group,
 #ifdef TILES
     if( use_tiles ) {
         is_memorized = [&]( const tripoint & q ) {
-            return !player_character.get_memorized_tile( getabs( q ) ).tile.empty();
+            return !player_character.get_memorized_tile( getabs( q ) ).get_id().empty();
         };
     } else {
 #endif
@@ -2995,6 +2991,9 @@ bool map::is_last_ter_wall( const bool no_furn, const point &p,
 
 bool map::tinder_at( const tripoint &p )
 {
+    if( !has_items( p ) ) {
+        return false;
+    }
     for( const item &i : i_at( p ) ) {
         if( i.has_flag( flag_TINDER ) ) {
             return true;
@@ -4568,9 +4567,12 @@ void map::i_clear( const tripoint &p )
         return;
     }
 
-    for( item &it : current_submap->get_items( l ) ) {
-        // remove from the active items cache (if it isn't there does nothing)
-        current_submap->active_items.remove( &it );
+    const bool had_items = current_submap->has_items( l );
+    if( had_items ) {
+        for( item &it : current_submap->get_items( l ) ) {
+            // remove from the active items cache (if it isn't there does nothing)
+            current_submap->active_items.remove( &it );
+        }
     }
     if( current_submap->active_items.empty() ) {
         // TODO: fix point types
@@ -4579,7 +4581,9 @@ void map::i_clear( const tripoint &p )
     }
 
     current_submap->set_lum( l, 0 );
-    current_submap->get_items( l ).clear();
+    if( had_items ) {
+        current_submap->get_items( l ).clear();
+    }
 }
 
 std::vector<item *> map::spawn_items( const tripoint &p, const std::vector<item> &new_items )
@@ -4666,19 +4670,25 @@ void map::spawn_item( const tripoint &p, const itype_id &type_id, const unsigned
 
 units::volume map::max_volume( const tripoint &p )
 {
-    return i_at( p ).max_volume();
+    if( !inbounds( p ) ) {
+        return 0_ml;
+    } else if( has_furn( p ) ) {
+        return furn( p ).obj().max_volume;
+    }
+    return ter( p ).obj().max_volume;
 }
 
 // total volume of all the things
 units::volume map::stored_volume( const tripoint &p )
 {
-    return i_at( p ).stored_volume();
+    // Checked first so that empty tiles don't get an item stack
+    return has_items( p ) ? i_at( p ).stored_volume() : 0_ml;
 }
 
 // free space
 units::volume map::free_volume( const tripoint &p )
 {
-    return i_at( p ).free_volume();
+    return max_volume( p ) - stored_volume( p );
 }
 
 item &map::add_item_or_charges( const tripoint &pos, item obj, bool overflow )
@@ -4705,7 +4715,8 @@ item &map::add_item_or_charges( const tripoint &pos, item obj, bool overflow )
 
     // Checks if sufficient space at tile to add item
     auto valid_limits = [&]( const tripoint & e ) {
-        return obj.volume() <= free_volume( e ) && i_at( e ).size() < MAX_ITEM_IN_SQUARE;
+        return obj.volume() <= free_volume( e ) &&
+               ( !has_items( e ) || i_at( e ).size() < MAX_ITEM_IN_SQUARE );
     };
 
     // Performs the actual insertion of the object onto the map
@@ -5363,7 +5374,7 @@ bool map::has_items( const tripoint &p ) const
         return false;
     }
 
-    return !current_submap->get_items( l ).empty();
+    return current_submap->has_items( l );
 }
 
 template <typename Stack>
@@ -5553,7 +5564,7 @@ std::list<item> map::use_charges( const tripoint &origin, const int range,
     }
 
     for( const tripoint &p : reachable_pts ) {
-        if( accessible_items( p ) ) {
+        if( has_items( p ) && accessible_items( p ) ) {
             std::list<item> tmp = i_at( p ).use_charges( type, quantity, p, filter, in_tools );
             ret.splice( ret.end(), tmp );
             if( quantity <= 0 ) {
@@ -5591,7 +5602,7 @@ units::energy map::consume_ups( const tripoint &origin, const int range, units::
     reachable_flood_steps( reachable_pts, origin, range, 1, 100 );
 
     for( const tripoint &p : reachable_pts ) {
-        if( accessible_items( p ) ) {
+        if( has_items( p ) && accessible_items( p ) ) {
 
             map_stack items = i_at( p );
             for( item &elem : items ) {
@@ -5618,7 +5629,7 @@ std::list<std::pair<tripoint, item *> > map::get_rc_items( const tripoint &p )
             continue;
         }
         for( pos.y = 0; pos.y < MAPSIZE_Y; pos.y++ ) {
-            if( p.y != -1 && p.y != pos.y ) {
+            if( ( p.y != -1 && p.y != pos.y ) || !has_items( pos ) ) {
                 continue;
             }
             map_stack items = i_at( pos );
@@ -7114,6 +7125,7 @@ void map::load( const tripoint_abs_sm &w, const bool update_vehicle,
     submaps_with_active_items.clear();
     set_abs_sub( w );
     clear_vehicle_level_caches();
+    generate_missing_submaps( pump_events );
     for( int gridx = 0; gridx < my_MAPSIZE; gridx++ ) {
         for( int gridy = 0; gridy < my_MAPSIZE; gridy++ ) {
             loadn( point( gridx, gridy ), update_vehicle, false );
@@ -7425,6 +7437,65 @@ static void generate_uniform( const tripoint_abs_sm &p, const ter_id &terrain_ty
     }
 }
 
+void map::generate_omt( const tripoint_abs_sm &grid_abs_sub )
+{
+    // Each overmap square is two nonants; to prevent overlap, generate only at
+    //  squares divisible by 2.
+    const tripoint_abs_omt grid_abs_omt = project_to<coords::omt>( grid_abs_sub );
+    const tripoint_abs_sm grid_abs_sub_rounded = project_to<coords::sm>( grid_abs_omt );
+
+    const oter_id terrain_type = overmap_buffer.ter( grid_abs_omt );
+
+    // Short-circuit if the map tile is uniform
+    // TODO: Replace with json mapgen functions.
+    if( terrain_type == oter_open_air ) {
+        generate_uniform( grid_abs_sub_rounded, t_open_air );
+    } else if( terrain_type == oter_empty_rock || terrain_type == oter_deep_rock ) {
+        generate_uniform( grid_abs_sub_rounded, t_rock );
+    } else if( terrain_type == oter_solid_earth ) {
+        generate_uniform( grid_abs_sub_rounded, ter_t_soil );
+    } else {
+        bool const main_inbounds =
+            this != &get_map() && get_map().inbounds( project_to<coords::ms>( grid_abs_sub ) );
+        tinymap tmp_map;
+        tmp_map.main_cleanup_override( false );
+        tmp_map.generate( grid_abs_sub_rounded, calendar::turn );
+        if( main_inbounds && tmp_map.is_main_cleanup_queued() ) {
+            _main_requires_cleanup = true;
+        }
+    }
+}
+
+void map::generate_missing_submaps( const bool pump_events )
+{
+    // Mapgen shares the global RNG, the overmap buffer, the mapbuffer and the
+    // creature tracker, so the jobs can not run concurrently; collecting them
+    // first still keeps the lookups out of the load loop and lets us handle
+    // window events between each of them instead of once per column.
+    std::vector<tripoint_abs_sm> pending;
+    std::unordered_set<tripoint_abs_omt> pending_omts;
+    const int zmin = zlevels ? -OVERMAP_DEPTH : abs_sub.z();
+    const int zmax = zlevels ? OVERMAP_HEIGHT : abs_sub.z();
+    for( int gridx = 0; gridx < my_MAPSIZE; gridx++ ) {
+        for( int gridy = 0; gridy < my_MAPSIZE; gridy++ ) {
+            for( int gridz = zmin; gridz <= zmax; gridz++ ) {
+                const tripoint_abs_sm grid_abs_sub( abs_sub.xy() + point( gridx, gridy ), gridz );
+                if( MAPBUFFER.lookup_submap( grid_abs_sub ) == nullptr &&
+                    pending_omts.insert( project_to<coords::omt>( grid_abs_sub ) ).second ) {
+                    pending.push_back( grid_abs_sub );
+                }
+            }
+        }
+    }
+
+    for( const tripoint_abs_sm &grid_abs_sub : pending ) {
+        generate_omt( grid_abs_sub );
+        if( pump_events ) {
+            inp_mngr.pump_events();
+        }
+    }
+}
+
 void map::loadn( const tripoint &grid, const bool update_vehicles, bool _actualize )
 {
     dbg( D_INFO ) << "map::loadn(game[" << g.get() << "], worldx[" << abs_sub.x()
@@ -7445,28 +7516,7 @@ void map::loadn( const tripoint &grid, const bool update_vehicles, bool _actuali
     if( tmpsub == nullptr ) {
         // It doesn't exist; we must generate it!
         dbg( D_INFO | D_WARNING ) << "map::loadn: Missing mapbuffer data.  Regenerating.";
-
-        // Each overmap square is two nonants; to prevent overlap, generate only at
-        //  squares divisible by 2.
-        const tripoint_abs_omt grid_abs_omt = project_to<coords::omt>( grid_abs_sub );
-        const tripoint_abs_sm grid_abs_sub_rounded = project_to<coords::sm>( grid_abs_omt );
-
-        const oter_id terrain_type = overmap_buffer.ter( grid_abs_omt );
-
-        // Short-circuit if the map tile is uniform
-        // TODO: Replace with json mapgen functions.
-        if( terrain_type == oter_open_air ) {
-            generate_uniform( grid_abs_sub_rounded, t_open_air );
-        } else if( terrain_type == oter_empty_rock || terrain_type == oter_deep_rock ) {
-            generate_uniform( grid_abs_sub_rounded, t_rock );
-        } else if( terrain_type == oter_solid_earth ) {
-            generate_uniform( grid_abs_sub_rounded, ter_t_soil );
-        } else {
-            tinymap tmp_map;
-            tmp_map.main_cleanup_override( false );
-            tmp_map.generate( grid_abs_sub_rounded, calendar::turn );
-            _main_requires_cleanup = main_inbounds && tmp_map.is_main_cleanup_queued();
-        }
+        generate_omt( grid_abs_sub );
 
         // This is the same call to MAPBUFFER as above!
         tmpsub = MAPBUFFER.lookup_submap( grid_abs_sub );
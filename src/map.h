@@ -1763,6 +1763,19 @@ class map
         void saven( const tripoint &grid );
         void loadn( const tripoint &grid, bool update_vehicles, bool _actualize = true );
         void loadn( const point &grid, bool update_vehicles, bool _actualize = true );
+        /**
+         * Runs mapgen for every overmap terrain overlapping this map that has no
+         * submaps in the @ref mapbuffer yet, so that @ref loadn only has to fetch them.
+         * The OMTs are collected up front and generated as one batch, in the same
+         * order loadn would reach them.
+         * @param pump_events If true, handle window events between each generated OMT.
+         */
+        void generate_missing_submaps( bool pump_events );
+        /**
+         * Generates the submaps of the OMT containing the submap at @p grid_abs_sub
+         * and stores them in the @ref mapbuffer.
+         */
+        void generate_omt( const tripoint_abs_sm &grid_abs_sub );
         /**
          * Fast forward a submap that has just been loading into this map.
          * This is used to rot and remove rotten items, grow plants, fill funnels etc.
@@ -1,3 +1,7 @@
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include "cata_assert.h"
 #include "cached_options.h"
 #include "cata_utility.h"
@@ -11,7 +15,7 @@
 #include "string_formatter.h"
 #include "translations.h"
 
-const memorized_terrain_tile mm_submap::default_tile{ "", 0, 0 };
+const memorized_terrain_tile mm_submap::default_tile{};
 const int mm_submap::default_symbol = 0;
 
 #define MM_SIZE (MAPSIZE * 2)
@@ -46,6 +50,41 @@ struct reg_coord_pair {
     }
 };
 
+namespace
+{
+/** All tile ids ever memorized, shared by all map memories */
+struct memorized_tile_ids {
+    std::vector<std::string> ids{ std::string() };
+    std::unordered_map<std::string, uint32_t> indices{ { std::string(), 0 } };
+};
+
+memorized_tile_ids &get_memorized_tile_ids()
+{
+    static memorized_tile_ids ids;
+    return ids;
+}
+} // namespace
+
+memorized_terrain_tile::memorized_terrain_tile( const std::string &id, const int subtile,
+        const int rotation ) :
+    subtile( static_cast<int16_t>( subtile ) ), rotation( static_cast<int16_t>( rotation ) )
+{
+    memorized_tile_ids &ids = get_memorized_tile_ids();
+    const auto it = ids.indices.find( id );
+    if( it != ids.indices.end() ) {
+        id_index = it->second;
+    } else {
+        id_index = static_cast<uint32_t>( ids.ids.size() );
+        ids.ids.push_back( id );
+        ids.indices.emplace( id, id_index );
+    }
+}
+
+const std::string &memorized_terrain_tile::get_id() const
+{
+    return get_memorized_tile_ids().ids[id_index];
+}
+
 mm_submap::mm_submap() = default;
 mm_submap::mm_submap( bool make_valid ) : valid( make_valid ) {}
 
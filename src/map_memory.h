@@ -2,7 +2,9 @@
 #ifndef CATA_SRC_MAP_MEMORY_H
 #define CATA_SRC_MAP_MEMORY_H
 
+#include <cstdint>
 #include <iosfwd>
+#include <string>
 
 #include "game_constants.h"
 #include "memory_fast.h"
@@ -13,18 +15,33 @@ class JsonIn;
 class JsonObject;
 class JsonOut;
 
+/**
+ * A memorized tile. The tile id is interned, so a memorized tile only takes a few bytes
+ * instead of a string per map square.
+ */
 struct memorized_terrain_tile {
-    std::string tile;
-    int subtile;
-    int rotation;
+    public:
+        memorized_terrain_tile() = default;
+        memorized_terrain_tile( const std::string &id, int subtile, int rotation );
 
-    inline bool operator==( const memorized_terrain_tile &rhs ) const {
-        return ( rotation == rhs.rotation ) && ( subtile == rhs.subtile ) && ( tile == rhs.tile );
-    }
+        /** Id of the memorized tile, empty if nothing is memorized */
+        const std::string &get_id() const;
 
-    inline bool operator!=( const memorized_terrain_tile &rhs ) const {
-        return !( *this == rhs );
-    }
+        int16_t subtile = 0;
+        int16_t rotation = 0;
+
+        inline bool operator==( const memorized_terrain_tile &rhs ) const {
+            return ( rotation == rhs.rotation ) && ( subtile == rhs.subtile ) &&
+                   ( id_index == rhs.id_index );
+        }
+
+        inline bool operator!=( const memorized_terrain_tile &rhs ) const {
+            return !( *this == rhs );
+        }
+
+    private:
+        // index into the table of interned tile ids, 0 is the empty id
+        uint32_t id_index = 0;
 };
 
 /** Represent a submap-sized chunk of tile memory. */
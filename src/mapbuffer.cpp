@@ -1,5 +1,7 @@
 #include "mapbuffer.h"
 
+#include <algorithm>
+#include <array>
 #include <chrono>
 #include <exception>
 #include <functional>
@@ -53,6 +55,7 @@ mapbuffer::~mapbuffer() = default;
 void mapbuffer::clear()
 {
     submaps.clear();
+    uniform_submaps.clear();
 }
 
 void mapbuffer::clear_outside_reality_bubble()
@@ -66,11 +69,81 @@ void mapbuffer::clear_outside_reality_bubble()
             it = submaps.erase( it );
         }
     }
+    // Compacted submaps are never inside the reality bubble.
+    uniform_submaps.clear();
+}
+
+void mapbuffer::compact_uniform_submaps( const tripoint_abs_sm &old_bubble_origin )
+{
+    map &here = get_map();
+    // Only the OMTs that were (partly) inside the bubble before it moved can have just left it,
+    // anything further out has already been looked at when it left.
+    const int bubble_size = here.getmapsize();
+    const point_abs_omt first = project_to<coords::omt>( old_bubble_origin.xy() );
+    const point_abs_omt last = project_to<coords::omt>( old_bubble_origin.xy() +
+                               point( bubble_size - 1, bubble_size - 1 ) );
+    for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
+        for( int x = first.x(); x <= last.x(); x++ ) {
+            for( int y = first.y(); y <= last.y(); y++ ) {
+                const tripoint_abs_omt om_addr( x, y, z );
+                if( !here.inbounds( om_addr ) ) {
+                    compact_uniform_quad( om_addr );
+                }
+            }
+        }
+    }
+}
+
+void mapbuffer::compact_uniform_quad( const tripoint_abs_omt &om_addr )
+{
+    const tripoint_abs_sm quad_origin = project_to<coords::sm>( om_addr );
+    std::array<tripoint_abs_sm, 4> quad = { {
+            quad_origin, quad_origin + point_south,
+            quad_origin + point_east, quad_origin + point_south_east
+        }
+    };
+    const bool plain = std::all_of( quad.begin(), quad.end(),
+    [this]( const tripoint_abs_sm & p ) {
+        const auto it = submaps.find( p );
+        return it != submaps.end() && it->second && it->second->is_plain_uniform();
+    } );
+    if( !plain ) {
+        return;
+    }
+    for( const tripoint_abs_sm &p : quad ) {
+        const auto it = submaps.find( p );
+        uniform_submaps[p] = { it->second->get_ter( point_zero ), it->second->last_touched };
+        submaps.erase( it );
+    }
+}
+
+bool mapbuffer::is_compacted( const tripoint_abs_sm &p ) const
+{
+    return uniform_submaps.count( p ) != 0;
+}
+
+void mapbuffer::expand_uniform_quad( const tripoint_abs_sm &p )
+{
+    const tripoint_abs_sm quad_origin = project_to<coords::sm>( project_to<coords::omt>( p ) );
+    for( const point &offset : {
+             point_zero, point_south, point_east, point_south_east
+         } ) {
+        const auto it = uniform_submaps.find( quad_origin + offset );
+        if( it == uniform_submaps.end() ) {
+            continue;
+        }
+        std::unique_ptr<submap> sm = std::make_unique<submap>();
+        sm->is_uniform = true;
+        sm->set_all_ter( it->second.ter );
+        sm->last_touched = it->second.last_touched;
+        submaps[it->first] = std::move( sm );
+        uniform_submaps.erase( it );
+    }
 }
 
 bool mapbuffer::add_submap( const tripoint_abs_sm &p, std::unique_ptr<submap> &sm )
 {
-    if( submaps.count( p ) ) {
+    if( submaps.count( p ) || uniform_submaps.count( p ) ) {
         return false;
     }
 
@@ -93,6 +166,9 @@ bool mapbuffer::add_submap( const tripoint_abs_sm &p, submap *sm )
 
 void mapbuffer::remove_submap( tripoint_abs_sm addr )
 {
+    if( uniform_submaps.erase( addr ) ) {
+        return;
+    }
     auto m_target = submaps.find( addr );
     if( m_target == submaps.end() ) {
         debugmsg( "Tried to remove non-existing submap %s", addr.to_string() );
@@ -106,7 +182,11 @@ submap *mapbuffer::lookup_submap( const tripoint_abs_sm &p )
     dbg( D_INFO ) << "mapbuffer::lookup_submap( x[" << p.x() << "], y[" << p.y() << "], z["
                   << p.z() << "])";
 
-    const auto iter = submaps.find( p );
+    auto iter = submaps.find( p );
+    if( iter == submaps.end() && uniform_submaps.count( p ) ) {
+        expand_uniform_quad( p );
+        iter = submaps.find( p );
+    }
     if( iter == submaps.end() ) {
         try {
             return unserialize_submaps( p );
@@ -119,6 +199,19 @@ submap *mapbuffer::lookup_submap( const tripoint_abs_sm &p )
     return iter->second.get();
 }
 
+bool mapbuffer::submap_exists( const tripoint_abs_sm &p )
+{
+    if( submaps.count( p ) != 0 || uniform_submaps.count( p ) != 0 ) {
+        return true;
+    }
+    try {
+        return unserialize_submaps( p ) != nullptr;
+    } catch( const std::exception &err ) {
+        debugmsg( "Failed to load submap %s: %s", p.to_string(), err.what() );
+    }
+    return false;
+}
+
 void mapbuffer::save( bool delete_after_save )
 {
     assure_dir_exist( PATH_INFO::world_base_save_path() + "/maps" );
@@ -173,6 +266,9 @@ void mapbuffer::save( bool delete_after_save )
     for( auto &elem : submaps_to_delete ) {
         remove_submap( elem );
     }
+    // Compacted submaps are uniform and outside the reality bubble, so just like
+    // the uniform submaps handled above they are dropped rather than saved.
+    uniform_submaps.clear();
 }
 
 void mapbuffer::save_quad(
@@ -7,8 +7,10 @@
 #include <map>
 #include <memory>
 
+#include "calendar.h"
 #include "coordinates.h"
 #include "point.h"
+#include "type_id.h"
 
 class JsonIn;
 class submap;
@@ -38,6 +40,16 @@ class mapbuffer
          */
         void clear_outside_reality_bubble();
 
+        /**
+         * Replaces the plain uniform submaps that left the reality bubble when it
+         * moved away from @p old_bubble_origin, see @ref submap::is_plain_uniform,
+         * with a compact record of their terrain.  Only whole OMT quads are
+         * compacted.  They are turned back into submaps when next looked up.
+         */
+        void compact_uniform_submaps( const tripoint_abs_sm &old_bubble_origin );
+        /** Whether the submap at @p p is kept as a compact record, only for the tests. */
+        bool is_compacted( const tripoint_abs_sm &p ) const;
+
         /** Add a new submap to the buffer.
          *
          * @param p The absolute world position in submap coordinates.
@@ -62,6 +74,12 @@ class mapbuffer
          */
         submap *lookup_submap( const tripoint_abs_sm &p );
 
+        /** Whether the submap at @p p has been generated, either in this buffer
+         * or on disk.  Unlike @ref lookup_submap this does not turn compacted
+         * submaps back into submaps.
+         */
+        bool submap_exists( const tripoint_abs_sm &p );
+
     private:
         using submap_map_t = std::map<tripoint_abs_sm, std::unique_ptr<submap>>;
 
@@ -84,6 +102,19 @@ class mapbuffer
             const tripoint_abs_omt &om_addr, std::list<tripoint_abs_sm> &submaps_to_delete,
             bool delete_after_save );
         submap_map_t submaps; // NOLINT(cata-serialize)
+
+        // Everything needed to recreate a plain uniform submap.
+        struct uniform_submap {
+            ter_id ter;
+            time_point last_touched;
+        };
+        // Compacted uniform submaps, see compact_uniform_submaps.  Like uniform
+        // submaps in general they are regenerated rather than saved.
+        std::map<tripoint_abs_sm, uniform_submap> uniform_submaps; // NOLINT(cata-serialize)
+        // Compacts the submaps of the quad at @p om_addr if they are all plain uniform.
+        void compact_uniform_quad( const tripoint_abs_omt &om_addr );
+        // Turns the compacted submaps of the quad containing @p p back into submaps.
+        void expand_uniform_quad( const tripoint_abs_sm &p );
 };
 
 extern mapbuffer MAPBUFFER;
@@ -1449,6 +1449,13 @@ class mapgen_value
         Id get( const mapgendata &dat ) const {
             return source_->get( dat );
         }
+        // Returns the value if it never depends on parameters or randomness.
+        cata::optional<Id> get_constant() const {
+            if( const id_source *constant = dynamic_cast<const id_source *>( source_.get() ) ) {
+                return constant->id;
+            }
+            return cata::nullopt;
+        }
         std::vector<StringId> all_possible_results( const mapgen_parameters &params ) const {
             return source_->all_possible_results( params );
         }
@@ -2708,7 +2715,11 @@ class jmapgen_furniture : public jmapgen_piece
             if( chosen_id.id().is_null() ) {
                 return;
             }
-            if( !dat.m.furn_set( point( x.get(), y.get() ), chosen_id ) ) {
+            place( dat, point( x.get(), y.get() ), chosen_id, context );
+        }
+        static void place( const mapgendata &dat, const point &p, const furn_id &chosen_id,
+                           const std::string &context ) {
+            if( !dat.m.furn_set( p, chosen_id ) ) {
                 debugmsg( "Problem setting furniture in %s", context );
             }
         }
@@ -2747,7 +2758,10 @@ class jmapgen_terrain : public jmapgen_piece
             if( chosen_id.id().is_null() ) {
                 return;
             }
-            point p( x.get(), y.get() );
+            place( dat, point( x.get(), y.get() ), chosen_id, context );
+        }
+        static void place( const mapgendata &dat, const point &p, const ter_id &chosen_id,
+                           const std::string &context ) {
             tripoint tp( p, dat.m.get_abs_sub().z() );
 
             ter_id terrain_here = dat.m.ter( p );
@@ -4346,9 +4360,46 @@ std::unordered_set<point> nested_mapgen::all_placement_coords() const
     return result;
 }
 
+// Whether the piece is placed exactly once, at a single fixed point.
+static bool is_static_placement( const jmapgen_place &where, const jmapgen_piece &what )
+{
+    return where.x.val == where.x.valmax && where.y.val == where.y.valmax &&
+           where.repeat.val == 1 && where.repeat.valmax == 1 &&
+           what.repeat.val == 1 && what.repeat.valmax == 1;
+}
+
 void jmapgen_objects::finalize()
 {
     std::stable_sort( objects.begin(), objects.end(), compare_phases );
+
+    static_terrain.clear();
+    static_furniture.clear();
+    auto it = std::lower_bound( objects.begin(), objects.end(), mapgen_phase::terrain,
+                                compare_phases );
+    for( ; it != objects.end() && it->second->phase() == mapgen_phase::terrain; ++it ) {
+        const jmapgen_terrain *ter = dynamic_cast<const jmapgen_terrain *>( it->second.get() );
+        if( ter == nullptr || !is_static_placement( it->first, *ter ) ) {
+            break;
+        }
+        const cata::optional<ter_id> id = ter->id.get_constant();
+        if( !id ) {
+            break;
+        }
+        static_terrain.push_back( { point( it->first.x.val, it->first.y.val ), *id, furn_id() } );
+    }
+    it = std::lower_bound( objects.begin(), objects.end(), mapgen_phase::furniture,
+                           compare_phases );
+    for( ; it != objects.end() && it->second->phase() == mapgen_phase::furniture; ++it ) {
+        const jmapgen_furniture *furn = dynamic_cast<const jmapgen_furniture *>( it->second.get() );
+        if( furn == nullptr || !is_static_placement( it->first, *furn ) ) {
+            break;
+        }
+        const cata::optional<furn_id> id = furn->id.get_constant();
+        if( !id ) {
+            break;
+        }
+        static_furniture.push_back( { point( it->first.x.val, it->first.y.val ), ter_id(), *id } );
+    }
 }
 
 void jmapgen_objects::check( const std::string &context, const mapgen_parameters &parameters ) const
@@ -4865,6 +4916,23 @@ void jmapgen_objects::apply( const mapgendata &dat, mapgen_phase phase, const po
 
     auto range_at_phase = std::equal_range( objects.begin(), objects.end(), phase, compare_phases );
 
+    // Place the precompiled static terrain and furniture first, then interpret the rest.
+    if( phase == mapgen_phase::terrain ) {
+        for( const static_placement &sp : static_terrain ) {
+            if( !sp.ter.id().is_null() ) {
+                jmapgen_terrain::place( dat, sp.p + offset, sp.ter, context );
+            }
+        }
+        range_at_phase.first += static_terrain.size();
+    } else if( phase == mapgen_phase::furniture ) {
+        for( const static_placement &sp : static_furniture ) {
+            if( !sp.furn.id().is_null() ) {
+                jmapgen_furniture::place( dat, sp.p + offset, sp.furn, context );
+            }
+        }
+        range_at_phase.first += static_furniture.size();
+    }
+
     for( auto it = range_at_phase.first; it != range_at_phase.second; ++it ) {
         const jmapgen_obj &obj = *it;
         jmapgen_place where = obj.first;
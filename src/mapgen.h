@@ -418,6 +418,24 @@ struct jmapgen_objects {
          */
         using jmapgen_obj = std::pair<jmapgen_place, shared_ptr_fast<const jmapgen_piece> >;
         std::vector<jmapgen_obj> objects;
+        /**
+         * Terrain or furniture that is always placed once at the same point with the
+         * same id, e.g. most of the "rows" of a mapgen.  These are resolved by
+         * @ref finalize, so applying them needs neither virtual dispatch nor a
+         * mapgen_value lookup.
+         */
+        struct static_placement {
+            point p;
+            ter_id ter;
+            furn_id furn;
+        };
+        /**
+         * The compiled form of the run of static placements at the start of the
+         * terrain and furniture phases.  Only that leading run is compiled, so the
+         * order things are placed in is unchanged.
+         */
+        std::vector<static_placement> static_terrain;
+        std::vector<static_placement> static_furniture;
         point m_offset;
         point mapgensize;
         point total_size;
@@ -127,19 +127,33 @@ bool Character::has_trait_variant( const trait_and_var &test ) const
 
 int Character::count_trait_flag( const json_character_flag &b ) const
 {
-    int ret = 0;
-    // UGLY, SLOW, should be cached as my_mutation_flags or something
-    for( const trait_id &mut : get_mutations() ) {
-        const mutation_branch &mut_data = mut.obj();
-        if( mut_data.flags.count( b ) > 0 ) {
-            ret++;
-        } else if( mut_data.activated ) {
-            Character &player = get_player_character();
-            if( ( mut_data.active_flags.count( b ) > 0 && player.has_active_mutation( mut ) ) ||
-                ( mut_data.inactive_flags.count( b ) > 0 && !player.has_active_mutation( mut ) ) ) {
-                ret++;
+    if( !trait_flag_cache.valid ) {
+        trait_flag_cache.flag_counts.clear();
+        trait_flag_cache.activated.clear();
+        for( const trait_id &mut : get_mutations() ) {
+            const mutation_branch &mut_data = mut.obj();
+            for( const json_character_flag &flag : mut_data.flags ) {
+                trait_flag_cache.flag_counts[flag]++;
+            }
+            if( mut_data.activated ) {
+                trait_flag_cache.activated.push_back( &mut_data );
             }
         }
+        trait_flag_cache.valid = true;
+    }
+
+    const auto iter = trait_flag_cache.flag_counts.find( b );
+    int ret = iter == trait_flag_cache.flag_counts.end() ? 0 : iter->second;
+    for( const mutation_branch *mut_data : trait_flag_cache.activated ) {
+        if( mut_data->flags.count( b ) > 0 ) {
+            // already counted above
+            continue;
+        }
+        Character &player = get_player_character();
+        if( ( mut_data->active_flags.count( b ) > 0 && player.has_active_mutation( mut_data->id ) ) ||
+            ( mut_data->inactive_flags.count( b ) > 0 && !player.has_active_mutation( mut_data->id ) ) ) {
+            ret++;
+        }
     }
 
     return ret;
@@ -189,6 +203,7 @@ void Character::set_mutation_unsafe( const trait_id &trait, const mutation_varia
     }
     my_mutations.emplace( trait, trait_data{variant} );
     cached_mutations.push_back( &trait.obj() );
+    trait_flag_cache.valid = false;
     mutation_effect( trait, false );
 }
 
@@ -239,6 +254,7 @@ void Character::unset_mutation( const trait_id &trait_ )
     cached_mutations.erase( std::remove( cached_mutations.begin(), cached_mutations.end(), &mut ),
                             cached_mutations.end() );
     my_mutations.erase( iter );
+    trait_flag_cache.valid = false;
     mutation_loss_effect( trait );
     do_mutation_updates();
 }
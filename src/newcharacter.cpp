@@ -4274,6 +4274,7 @@ void Character::clear_mutations()
         mutation_loss_effect( trait );
     }
     cached_mutations.clear();
+    trait_flag_cache.valid = false;
     recalc_sight_limits();
     calc_encumbrance();
 }
@@ -1948,6 +1948,11 @@ void options_manager::add_options_graphics()
          true
        );
 
+    add( "ACTIVITY_FRAME_RATE", "graphics", to_translation( "Activity frame rate limit" ),
+         to_translation( "Maximum frames per second drawn while time passes on its own: waiting, sleeping, crafting and other activities, and auto-travel.  Lower values let long activities finish sooner.  0 = no limit." ),
+         0, 240, 30
+       );
+
     add_empty_line();
 
     add( "ENABLE_ASCII_TITLE", "graphics",
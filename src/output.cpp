@@ -27,6 +27,8 @@
 #include "input.h"
 #include "item.h"
 #include "line.h"
+#include "lru_cache.h"
+#include "memory_fast.h"
 #include "name.h"
 #include "options.h"
 #include "point.h"
@@ -112,13 +114,10 @@ std::string string_from_int( const catacurses::chtype ch )
 }
 
 // utf8 version
-std::vector<std::string> foldstring( const std::string &str, int width, const char split )
+static std::vector<std::string> foldstring_uncached( const std::string &str, int width,
+        const char split )
 {
     std::vector<std::string> lines;
-    if( width < 1 ) {
-        lines.push_back( str );
-        return lines;
-    }
     std::stringstream sstr( str );
     std::string strline;
     std::vector<std::string> tags;
@@ -175,6 +174,30 @@ std::vector<std::string> foldstring( const std::string &str, int width, const ch
     return lines;
 }
 
+std::vector<std::string> foldstring( const std::string &str, int width, const char split )
+{
+    if( width < 1 ) {
+        return { str };
+    }
+    // Panels, item info and the message log fold the same text again on every redraw.
+    // The split character comes first and the width is followed by a newline, so keys of
+    // different arguments can not be equal.
+    using folded_lines = shared_ptr_fast<const std::vector<std::string>>;
+    static lru_cache<std::string, folded_lines> cache;
+    constexpr int cache_size = 256;
+    std::string key( 1, split );
+    key += std::to_string( width );
+    key += '\n';
+    key += str;
+    folded_lines lines = cache.get( key, nullptr );
+    if( !lines ) {
+        lines = make_shared_fast<const std::vector<std::string>>( foldstring_uncached( str, width,
+                split ) );
+    }
+    cache.insert( cache_size, key, lines );
+    return *lines;
+}
+
 std::vector<std::string> split_by_color( const std::string &s )
 {
     std::vector<std::string> ret;
@@ -239,21 +262,22 @@ void print_colored_text( const catacurses::window &w, const point &p, nc_color &
     std::stack<nc_color> color_stack;
     color_stack.push( color );
 
-    for( auto seg : color_segments ) {
+    for( const std::string &seg : color_segments ) {
         if( seg.empty() ) {
             continue;
         }
 
+        color_tag_parse_result::tag_type type = color_tag_parse_result::non_color_tag;
         if( seg[0] == '<' ) {
-            const color_tag_parse_result::tag_type type = update_color_stack(
-                        color_stack, seg, color_error );
-            if( type != color_tag_parse_result::non_color_tag ) {
-                seg = rm_prefix( seg );
-            }
+            type = update_color_stack( color_stack, seg, color_error );
         }
 
         color = color_stack.empty() ? base_color : color_stack.top();
-        wprintz( w, color, seg );
+        if( type != color_tag_parse_result::non_color_tag ) {
+            wprintz( w, color, rm_prefix( seg ) );
+        } else {
+            wprintz( w, color, seg );
+        }
     }
 }
 
@@ -2975,9 +2975,80 @@ void overmap::ter_set( const tripoint_om_omt &p, const oter_id &id )
     if( id->has_flag( oter_flags::requires_predecessor ) ) {
         predecessors_[p].push_back( val );
     }
+    if( terrain_index_valid && val != id ) {
+        const oter_id default_terrain = get_default_terrain( p.z() );
+        if( val != default_terrain ) {
+            std::vector<tripoint_om_omt> &old_locations = terrain_index[val];
+            auto it = std::find( old_locations.begin(), old_locations.end(), p );
+            if( it != old_locations.end() ) {
+                *it = old_locations.back();
+                old_locations.pop_back();
+            }
+        }
+        if( id != default_terrain ) {
+            terrain_index[id].push_back( p );
+        }
+    }
     val = id;
 }
 
+void overmap::build_terrain_index() const
+{
+    terrain_index.clear();
+    for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
+        const oter_id default_terrain = get_default_terrain( z );
+        const map_layer &l = layer[z + OVERMAP_DEPTH];
+        for( int x = 0; x < OMAPX; x++ ) {
+            for( int y = 0; y < OMAPY; y++ ) {
+                const oter_id &t = l.terrain[x][y];
+                if( t != default_terrain ) {
+                    terrain_index[t].emplace_back( x, y, z );
+                }
+            }
+        }
+    }
+    terrain_index_valid = true;
+}
+
+std::vector<tripoint_om_omt> overmap::find_all_omt(
+    const std::vector<std::pair<std::string, ot_match_type>> &types ) const
+{
+    const auto matches = [&types]( const oter_id & oter ) {
+        return std::any_of( types.begin(), types.end(),
+        [&oter]( const std::pair<std::string, ot_match_type> &type ) {
+            return is_ot_match( type.first, oter, type.second );
+        } );
+    };
+
+    if( !terrain_index_valid ) {
+        build_terrain_index();
+    }
+
+    std::vector<tripoint_om_omt> result;
+    for( const std::pair<const oter_id, std::vector<tripoint_om_omt>> &entry : terrain_index ) {
+        if( !entry.second.empty() && matches( entry.first ) ) {
+            result.insert( result.end(), entry.second.begin(), entry.second.end() );
+        }
+    }
+    // The default terrain of each z-level is not indexed, so fall back to
+    // scanning the layer in the rare case it is being searched for.
+    for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
+        const oter_id default_terrain = get_default_terrain( z );
+        if( !matches( default_terrain ) ) {
+            continue;
+        }
+        const map_layer &l = layer[z + OVERMAP_DEPTH];
+        for( int x = 0; x < OMAPX; x++ ) {
+            for( int y = 0; y < OMAPY; y++ ) {
+                if( l.terrain[x][y] == default_terrain ) {
+                    result.emplace_back( x, y, z );
+                }
+            }
+        }
+    }
+    return result;
+}
+
 const oter_id &overmap::ter( const tripoint_om_omt &p ) const
 {
     if( !inbounds( p ) ) {
@@ -3853,20 +3924,12 @@ const city &overmap::get_nearest_city( const tripoint_om_omt &p ) const
 tripoint_om_omt overmap::find_random_omt( const std::pair<std::string, ot_match_type> &target,
         cata::optional<city> target_city ) const
 {
-    const bool check_nearest_city = target_city.has_value();
-    std::vector<tripoint_om_omt> valid;
-    for( int i = 0; i < OMAPX; i++ ) {
-        for( int j = 0; j < OMAPY; j++ ) {
-            for( int k = -OVERMAP_DEPTH; k <= OVERMAP_HEIGHT; k++ ) {
-                tripoint_om_omt p( i, j, k );
-                if( is_ot_match( target.first, ter( p ), target.second ) ) {
-                    if( !check_nearest_city ||
-                        ( check_nearest_city && get_nearest_city( p ) == target_city.value() ) ) {
-                        valid.push_back( p );
-                    }
-                }
-            }
-        }
+    std::vector<tripoint_om_omt> valid = find_all_omt( { target } );
+    if( target_city.has_value() ) {
+        valid.erase( std::remove_if( valid.begin(), valid.end(),
+        [&]( const tripoint_om_omt & p ) {
+            return !( get_nearest_city( p ) == target_city.value() );
+        } ), valid.end() );
     }
     return random_entry( valid, tripoint_om_omt( tripoint_min ) );
 }
@@ -6507,6 +6570,8 @@ void overmap::open( overmap_special_batch &enabled_specials )
         // pointers looks like (north, south, west, east)
         generate( pointers[0], pointers[3], pointers[1], pointers[2], enabled_specials );
     }
+    // Loading and generation write the terrain layers directly.
+    terrain_index_valid = false;
 }
 
 // Note: this may throw io errors from std::ofstream
@@ -6652,9 +6717,7 @@ bool overmap::is_omt_generated( const tripoint_om_omt &loc ) const
     tripoint_abs_sm global_sm_loc =
         project_to<coords::sm>( project_combine( pos(), loc ) );
 
-    const bool is_generated = MAPBUFFER.lookup_submap( global_sm_loc ) != nullptr;
-
-    return is_generated;
+    return MAPBUFFER.submap_exists( global_sm_loc );
 }
 
 overmap_special_id overmap_specials::create_building_from( const string_id<oter_type_t> &base )
@@ -263,6 +263,13 @@ class overmap
          * coordinates), or empty vector if no matching terrain is found.
          */
         std::vector<point_abs_omt> find_terrain( const std::string &term, int zlevel ) const;
+        /**
+         * Return the (local) overmap terrain coordinates of every terrain on this
+         * overmap matching any of the given types, on all z-levels.
+         * Answered from the terrain index rather than by scanning every OMT.
+         */
+        std::vector<tripoint_om_omt> find_all_omt(
+            const std::vector<std::pair<std::string, ot_match_type>> &types ) const;
 
         void ter_set( const tripoint_om_omt &p, const oter_id &id );
         // ter has bounds checking, and returns ot_null when out of bounds.
@@ -400,6 +407,14 @@ class overmap
         // Reconstructed on load, so need not be serialized.
         std::unordered_set<tripoint_om_omt> safe_at_worldgen; // NOLINT(cata-serialize)
 
+        // Records the locations of every terrain other than the default terrain of
+        // its z-level, so searches need not scan the whole overmap.
+        // Built lazily by the first search and then kept up to date by ter_set.
+        // Reconstructed on demand, so need not be serialized.
+        mutable std::unordered_map<oter_id, std::vector<tripoint_om_omt>>
+        terrain_index; // NOLINT(cata-serialize)
+        mutable bool terrain_index_valid = false; // NOLINT(cata-serialize)
+
         // For oter_ts with the requires_predecessor flag, we need to store the
         // predecessor terrains so they can be used for mapgen later
         std::unordered_map<tripoint_om_omt, std::vector<oter_id>> predecessors_;
@@ -420,6 +435,7 @@ class overmap
 
         // Initialize
         void init_layers();
+        void build_terrain_index() const;
         // open existing overmap, or generate a new one
         void open( overmap_special_batch &enabled_specials );
     public:
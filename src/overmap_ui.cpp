@@ -709,6 +709,12 @@ static void draw_ascii(
         }
     }
 
+    // Notes and vehicles are looked up once for the whole window, searching them for every
+    // drawn tile is linear in their count
+    const point_abs_omt corner_se = corner.xy() + point( om_map_width - 1, om_map_height - 1 );
+    const overmap_overlays overlays = blink ? overmap_buffer.get_overlays( corner, corner_se ) :
+                                      overmap_overlays();
+
     for( int i = 0; i < om_map_width; ++i ) {
         for( int j = 0; j < om_map_height; ++j ) {
             const tripoint_abs_omt omp = corner + point( i, j );
@@ -747,10 +753,10 @@ static void draw_ascii(
                 } else if( target.z() < center.z() ) {
                     ter_sym = "v";
                 }
-            } else if( blink && uistate.overmap_show_map_notes && overmap_buffer.has_note( omp ) ) {
+            } else if( blink && uistate.overmap_show_map_notes && overlays.note( omp.xy() ) ) {
                 // Display notes in all situations, even when not seen
                 std::tie( ter_sym, ter_color, std::ignore ) =
-                    get_note_display_info( overmap_buffer.note( omp ) );
+                    get_note_display_info( *overlays.note( omp.xy() ) );
             } else if( !see ) {
                 // All cases above ignore the seen-status,
                 ter_color = oter_unexplored.obj().get_color();
@@ -781,7 +787,7 @@ static void draw_ascii(
                 // Display Hordes only when within player line-of-sight
                 ter_color = c_green;
                 ter_sym = overmap_buffer.get_horde_size( omp ) > HORDE_VISIBILITY_SIZE * 2 ? "Z" : "z";
-            } else if( blink && overmap_buffer.has_vehicle( omp ) ) {
+            } else if( blink && overlays.has_vehicle( omp.xy() ) ) {
                 ter_color = c_cyan;
                 ter_sym = overmap_buffer.get_vehicle_ter_sym( omp );
             } else if( !sZoneName.empty() && tripointZone.xy() == omp.xy() ) {
@@ -857,7 +863,7 @@ static void draw_ascii(
                     }
                 }
                 // Highlight areas that already have been generated
-                if( MAPBUFFER.lookup_submap( project_to<coords::sm>( omp ) ) ) {
+                if( MAPBUFFER.submap_exists( project_to<coords::sm>( omp ) ) ) {
                     ter_color = red_background( ter_color );
                 }
             }
@@ -559,6 +559,41 @@ std::string overmapbuffer::get_vehicle_tile_id( const tripoint_abs_omt &omt )
     return tile_id;
 }
 
+overmap_overlays overmapbuffer::get_overlays( const tripoint_abs_omt &corner_nw,
+        const point_abs_omt &corner_se )
+{
+    overmap_overlays result;
+    const int z = corner_nw.z();
+    if( z < -OVERMAP_DEPTH || z > OVERMAP_HEIGHT ) {
+        return result;
+    }
+    const inclusive_rectangle<point_abs_omt> area( corner_nw.xy(), corner_se );
+    const point_abs_om om_nw = project_to<coords::om>( corner_nw.xy() );
+    const point_abs_om om_se = project_to<coords::om>( corner_se );
+    for( int x = om_nw.x(); x <= om_se.x(); ++x ) {
+        for( int y = om_nw.y(); y <= om_se.y(); ++y ) {
+            const point_abs_om omp( x, y );
+            if( !has( omp ) ) {
+                continue;
+            }
+            const overmap &om = get( omp );
+            for( const om_note &n : om.layer[z + OVERMAP_DEPTH].notes ) {
+                const point_abs_omt p = project_combine( omp, n.p );
+                if( area.contains( p ) ) {
+                    result.notes.emplace( p, n.text );
+                }
+            }
+            for( const auto &v : om.vehicles ) {
+                const point_abs_omt p = project_combine( omp, v.second.p.xy() );
+                if( area.contains( p ) ) {
+                    result.vehicles.insert( p );
+                }
+            }
+        }
+    }
+    return result;
+}
+
 void overmapbuffer::signal_hordes( const tripoint_abs_sm &center, const int sig_power )
 {
     const int radius = sig_power;
@@ -1170,6 +1205,34 @@ tripoint_abs_omt overmapbuffer::find_closest(
     return find_closest( origin, params );
 }
 
+// Horizontal distance from @p p to the nearest OMT of the overmap at @p om_pos.
+static int square_dist_to_overmap( const point_abs_omt &p, const point_abs_om &om_pos )
+{
+    const point_abs_omt om_min = project_to<coords::omt>( om_pos );
+    const point_abs_omt om_max = om_min + point( OMAPX - 1, OMAPY - 1 );
+    const int dx = std::max( { 0, om_min.x() - p.x(), p.x() - om_max.x() } );
+    const int dy = std::max( { 0, om_min.y() - p.y(), p.y() - om_max.y() } );
+    return std::max( dx, dy );
+}
+
+std::vector<tripoint_abs_omt> overmapbuffer::find_all_in_overmap( const point_abs_om &om_pos,
+        const tripoint_abs_omt &origin, int max_dist, const omt_find_params &params )
+{
+    std::vector<tripoint_abs_omt> result;
+    const overmap *om = params.existing_only ? get_existing( om_pos ) : &get( om_pos );
+    if( om == nullptr ) {
+        return result;
+    }
+    for( const tripoint_om_omt &p : om->find_all_omt( params.types ) ) {
+        const tripoint_abs_omt loc = project_combine( om_pos, p );
+        const int dist_xy = square_dist( origin.xy(), loc.xy() );
+        if( dist_xy >= params.min_distance && dist_xy <= max_dist ) {
+            result.push_back( loc );
+        }
+    }
+    return result;
+}
+
 tripoint_abs_omt overmapbuffer::find_closest( const tripoint_abs_omt &origin,
         const omt_find_params &params )
 {
@@ -1193,29 +1256,33 @@ tripoint_abs_omt overmapbuffer::find_closest( const tripoint_abs_omt &origin,
     // See overmap::place_specials for how we attempt to insure specials are placed within this
     // range.  The actual number is 5 because 1 covers the current overmap,
     // and each additional one expends the search to the next concentric circle of overmaps.
-    const int min_dist = params.min_distance;
     const int max_dist = params.search_range ? params.search_range : OMAPX * 5;
 
     std::vector<tripoint_abs_omt> result;
     cata::optional<int> found_dist;
 
-    for( const point_abs_omt &loc_xy : closest_points_first( origin.xy(), min_dist, max_dist ) ) {
-        const int dist_xy = square_dist( origin.xy(), loc_xy );
-
-        if( found_dist && *found_dist < dist_xy ) {
+    // Visit the overmaps in concentric rings around the origin, looking each one
+    // up in its terrain index, and stop once no closer match can exist.
+    const point_abs_om origin_om = project_to<coords::om>( origin.xy() );
+    const int max_om_dist = divide_round_up( max_dist, OMAPX ) + 1;
+    for( int om_dist = 0; om_dist <= max_om_dist; om_dist++ ) {
+        if( found_dist && ( om_dist - 1 ) * OMAPX > *found_dist ) {
             break;
         }
-
-        for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
-            const tripoint_abs_omt loc( loc_xy, z );
-            const int dist = square_dist( origin, loc );
-
-            if( found_dist && *found_dist < dist ) {
+        for( const point_abs_om &om_pos : closest_points_first( origin_om, om_dist, om_dist ) ) {
+            const int om_square_dist = square_dist_to_overmap( origin.xy(), om_pos );
+            if( om_square_dist > max_dist || ( found_dist && om_square_dist > *found_dist ) ) {
                 continue;
             }
-
-            if( is_findable_location( loc, params ) ) {
-                found_dist = dist;
+            for( const tripoint_abs_omt &loc : find_all_in_overmap( om_pos, origin, max_dist, params ) ) {
+                const int dist = square_dist( origin, loc );
+                if( ( found_dist && *found_dist < dist ) || !is_findable_location( loc, params ) ) {
+                    continue;
+                }
+                if( !found_dist || dist < *found_dist ) {
+                    found_dist = dist;
+                    result.clear();
+                }
                 result.push_back( loc );
             }
         }
@@ -1229,14 +1296,24 @@ std::vector<tripoint_abs_omt> overmapbuffer::find_all( const tripoint_abs_omt &o
 {
     std::vector<tripoint_abs_omt> result;
     // dist == 0 means search a whole overmap diameter.
-    const int min_dist = params.min_distance;
     const int max_dist = params.search_range ? params.search_range : OMAPX;
 
-    for( const tripoint_abs_omt &loc : closest_points_first( origin, min_dist, max_dist ) ) {
-        if( is_findable_location( loc, params ) ) {
-            result.push_back( loc );
+    const point_abs_om origin_om = project_to<coords::om>( origin.xy() );
+    const int max_om_dist = divide_round_up( max_dist, OMAPX ) + 1;
+    for( const point_abs_om &om_pos : closest_points_first( origin_om, max_om_dist ) ) {
+        if( square_dist_to_overmap( origin.xy(), om_pos ) > max_dist ) {
+            continue;
+        }
+        for( const tripoint_abs_omt &loc : find_all_in_overmap( om_pos, origin, max_dist, params ) ) {
+            if( loc.z() == origin.z() && is_findable_location( loc, params ) ) {
+                result.push_back( loc );
+            }
         }
     }
+    std::stable_sort( result.begin(), result.end(),
+    [&origin]( const tripoint_abs_omt & lhs, const tripoint_abs_omt & rhs ) {
+        return square_dist( origin, lhs ) < square_dist( origin, rhs );
+    } );
 
     return result;
 }
@@ -117,6 +117,25 @@ struct overmap_with_local_coords {
     }
 };
 
+/**
+ * Notes and vehicles within an area of one z-level, gathered once for drawing the overmap
+ * instead of searching the overmap's notes and vehicles for every drawn tile.
+ */
+struct overmap_overlays {
+    /** Note text of each OMT that has a note */
+    std::unordered_map<point_abs_omt, std::string> notes;
+    /** OMTs with a known vehicle on any z-level, like @ref overmapbuffer::has_vehicle */
+    std::unordered_set<point_abs_omt> vehicles;
+
+    const std::string *note( const point_abs_omt &p ) const {
+        const auto it = notes.find( p );
+        return it == notes.end() ? nullptr : &it->second;
+    }
+    bool has_vehicle( const point_abs_omt &p ) const {
+        return vehicles.count( p ) != 0;
+    }
+};
+
 /*
  * Standard arguments for finding overmap terrain
  * @param origin Location of search
@@ -195,6 +214,12 @@ class overmapbuffer
         std::vector<om_vehicle> get_vehicle( const tripoint_abs_omt &p );
         std::string get_vehicle_ter_sym( const tripoint_abs_omt &omt );
         std::string get_vehicle_tile_id( const tripoint_abs_omt &omt );
+        /**
+         * Notes and vehicles within the rectangle spanned by the two corners (inclusive) on
+         * the z-level of @p corner_nw. Only existing overmaps are looked at.
+         */
+        overmap_overlays get_overlays( const tripoint_abs_omt &corner_nw,
+                                       const point_abs_omt &corner_se );
         const regional_settings &get_settings( const tripoint_abs_omt &p );
         /**
          * Accessors for horde introspection into overmaps.
@@ -528,6 +553,14 @@ class overmapbuffer
          * see omt_find_params for definitions of the terms
          */
         bool is_findable_location( const tripoint_abs_omt &location, const omt_find_params &params );
+        /**
+         * Return every location on the overmap at @p om_pos matching the params' types
+         * whose horizontal distance from @p origin is between the params' min_distance
+         * and @p max_dist. The remaining criteria are left to is_findable_location.
+         * Creates the overmap if necessary, unless params.existing_only is set.
+         */
+        std::vector<tripoint_abs_omt> find_all_in_overmap( const point_abs_om &om_pos,
+                const tripoint_abs_omt &origin, int max_dist, const omt_find_params &params );
 
         std::unordered_map< point_abs_om, std::unique_ptr< overmap > > overmaps;
         /**
@@ -438,6 +438,7 @@ void recipe::finalize()
     reqs_internal.clear();
 
     deduped_requirements_ = deduped_requirement_data( requirements_, ident() );
+    disassembly_requirements_.reset();
 
     if( contained && container.is_null() ) {
         container = item::find_type( result_ )->default_container.value_or( "null" );
@@ -1002,19 +1003,39 @@ bool recipe::will_be_blacklisted() const
 
 std::function<bool( const item & )> recipe::get_component_filter(
     const recipe_filter_flags flags ) const
+{
+    return component_filter( get_component_filter_flags( flags ) );
+}
+
+recipe_filter_flags recipe::get_component_filter_flags( recipe_filter_flags flags ) const
 {
     const item result = create_result();
 
     // Disallow crafting of non-perishables with rotten components
     // Make an exception for items with the ALLOW_ROTTEN flag such as seeds
-    const bool recipe_forbids_rotten =
-        result.is_food() && !result.goes_bad() && !has_flag( "ALLOW_ROTTEN" );
-    const bool flags_forbid_rotten =
-        static_cast<bool>( flags & recipe_filter_flags::no_rotten );
-    const bool flags_forbid_favorites =
-        static_cast<bool>( flags & recipe_filter_flags::no_favorite );
+    if( result.is_food() && !result.goes_bad() && !has_flag( "ALLOW_ROTTEN" ) ) {
+        flags |= recipe_filter_flags::no_rotten;
+    }
+
+    // If the result is made hot, we can allow frozen components.
+    // EDIBLE_FROZEN components ( e.g. flour, chocolate ) are allowed as well
+    // Otherwise forbid them
+    if( result.has_temperature() && !hot_result() ) {
+        flags |= recipe_filter_flags::no_frozen;
+    }
+
+    // Disallow usage of non-full magazines as components
+    // This is primarily used to require a fully charged battery, but works for any magazine.
+    if( has_flag( "NEED_FULL_MAGAZINE" ) ) {
+        flags |= recipe_filter_flags::no_partial_magazine;
+    }
+    return flags;
+}
+
+std::function<bool( const item & )> recipe::component_filter( const recipe_filter_flags flags )
+{
     std::function<bool( const item & )> rotten_filter = return_true<item>;
-    if( recipe_forbids_rotten || flags_forbid_rotten ) {
+    if( flags & recipe_filter_flags::no_rotten ) {
         rotten_filter = []( const item & component ) {
             return !component.rotten();
         };
@@ -1022,26 +1043,21 @@ std::function<bool( const item & )> recipe::get_component_filter(
 
     // Disallow crafting using favorited items as components
     std::function<bool( const item & )> favorite_filter = return_true<item>;
-    if( flags_forbid_favorites ) {
+    if( flags & recipe_filter_flags::no_favorite ) {
         favorite_filter = []( const item & component ) {
             return !component.is_favorite;
         };
     }
 
-    // If the result is made hot, we can allow frozen components.
-    // EDIBLE_FROZEN components ( e.g. flour, chocolate ) are allowed as well
-    // Otherwise forbid them
     std::function<bool( const item & )> frozen_filter = return_true<item>;
-    if( result.has_temperature() && !hot_result() ) {
+    if( flags & recipe_filter_flags::no_frozen ) {
         frozen_filter = []( const item & component ) {
             return !component.has_flag( flag_FROZEN ) || component.has_flag( flag_EDIBLE_FROZEN );
         };
     }
 
-    // Disallow usage of non-full magazines as components
-    // This is primarily used to require a fully charged battery, but works for any magazine.
     std::function<bool( const item & )> magazine_filter = return_true<item>;
-    if( has_flag( "NEED_FULL_MAGAZINE" ) ) {
+    if( flags & recipe_filter_flags::no_partial_magazine ) {
         magazine_filter = []( const item & component ) {
             if( component.ammo_remaining() == 0 ) {
                 return false;
@@ -1061,6 +1077,18 @@ std::function<bool( const item & )> recipe::get_component_filter(
     };
 }
 
+const requirement_data &recipe::disassembly_requirements() const
+{
+    static const requirement_data no_requirements;
+    if( !reversible ) {
+        return no_requirements;
+    }
+    if( !disassembly_requirements_ ) {
+        disassembly_requirements_ = simple_requirements().disassembly_requirements();
+    }
+    return *disassembly_requirements_;
+}
+
 bool recipe::is_practice() const
 {
     return practice_data.has_value();
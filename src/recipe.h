@@ -30,6 +30,8 @@ enum class recipe_filter_flags : int {
     none = 0,
     no_rotten = 1,
     no_favorite = 2,
+    no_frozen = 4,
+    no_partial_magazine = 8,
 };
 
 enum class recipe_time_flag : int {
@@ -159,18 +161,20 @@ class recipe
 
         std::function<bool( const item & )> get_component_filter(
             recipe_filter_flags = recipe_filter_flags::none ) const;
+        /**
+         * The given flags plus the restrictions this recipe places on its components.
+         * Recipes with equal component filter flags accept exactly the same components.
+         */
+        recipe_filter_flags get_component_filter_flags(
+            recipe_filter_flags = recipe_filter_flags::none ) const;
+        /** Component filter that applies exactly the given flags, see @ref get_component_filter_flags */
+        static std::function<bool( const item & )> component_filter( recipe_filter_flags flags );
 
         /** Prevent this recipe from ever being added to the player's learned recipes ( used for special NPC crafting ) */
         bool never_learn = false;
 
         /** If recipe can be used for disassembly fetch the combined requirements */
-        requirement_data disassembly_requirements() const {
-            if( reversible ) {
-                return simple_requirements().disassembly_requirements();
-            } else {
-                return {};
-            }
-        }
+        const requirement_data &disassembly_requirements() const;
 
         /// @returns The name (@ref item::nname) of the resulting item (@ref result).
         /// @param decorated whether the result includes decoration (favorite mark, etc).
@@ -319,6 +323,9 @@ class recipe
         /** Deduped version constructed from the above requirements_ */
         deduped_requirement_data deduped_requirements_;
 
+        // Built from requirements_ by the first call to disassembly_requirements()
+        mutable cata::optional<requirement_data> disassembly_requirements_;
+
         std::set<std::string> flags;
 
         /** If set (zero or positive) set charges of output result for items counted by charges */
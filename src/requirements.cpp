@@ -1175,8 +1175,7 @@ requirement_data requirement_data::disassembly_requirements() const
     // TODO:
     // Allow jsonizing those tool replacements
 
-    // Make a copy
-    // Maybe TODO: Cache it somewhere and return a reference instead
+    // Make a copy, recipe::disassembly_requirements() caches the result
     requirement_data ret = *this;
     auto new_qualities = std::vector<quality_requirement>();
     bool remove_fire = false;
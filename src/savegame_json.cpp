@@ -838,6 +838,7 @@ void Character::load( const JsonObject &data )
         on_mutation_gain( mut.first );
         cached_mutations.push_back( &mut.first.obj() );
     }
+    trait_flag_cache.valid = false;
     recalculate_size();
 
     data.read( "my_bionics", *my_bionics );
@@ -2965,6 +2966,7 @@ void item::io( Archive &archive )
     erase_if( item_tags, [&]( const flag_id & f ) {
         return !f.is_valid();
     } );
+    item_tag_bits = flag_bitset( item_tags );
 
     if( note_read ) {
         snip_id = SNIPPET.migrate_hash_to_id( note );
@@ -3000,13 +3002,7 @@ void item::io( Archive &archive )
     // Books without any chapters don't need to store a remaining-chapters
     // counter, it will always be 0 and it prevents proper stacking.
     if( get_chapters() == 0 ) {
-        for( auto it = item_vars.begin(); it != item_vars.end(); ) {
-            if( it->first.compare( 0, 19, "remaining-chapters-" ) == 0 ) {
-                item_vars.erase( it++ );
-            } else {
-                ++it;
-            }
-        }
+        item_vars.erase_prefixed( "remaining-chapters-" );
     }
 
     // Remove stored translated gerund in favor of storing the inscription tool type
@@ -3933,7 +3929,7 @@ void mm_submap::serialize( JsonOut &jsout ) const
 
     const auto write_seq = [&]() {
         jsout.start_array();
-        jsout.write( last.tile.tile );
+        jsout.write( last.tile.get_id() );
         jsout.write( last.tile.subtile );
         jsout.write( last.tile.rotation );
         jsout.write( last.symbol );
@@ -3980,9 +3976,10 @@ void mm_submap::deserialize( JsonIn &jsin )
                 remaining -= 1;
             } else {
                 jsin.start_array();
-                elem.tile.tile = jsin.get_string();
-                elem.tile.subtile = jsin.get_int();
-                elem.tile.rotation = jsin.get_int();
+                const std::string id = jsin.get_string();
+                const int subtile = jsin.get_int();
+                const int rotation = jsin.get_int();
+                elem.tile = memorized_terrain_tile( id, subtile, rotation );
                 elem.symbol = jsin.get_int();
                 if( jsin.test_int() ) {
                     remaining = jsin.get_int() - 1;
@@ -4054,9 +4051,10 @@ void map_memory::load_legacy( JsonIn &jsin )
         p.y = jsin.get_int();
         p.z = jsin.get_int();
         mig_elem &elem = elems[p];
-        elem.tile.tile = jsin.get_string();
-        elem.tile.subtile = jsin.get_int();
-        elem.tile.rotation = jsin.get_int();
+        const std::string id = jsin.get_string();
+        const int subtile = jsin.get_int();
+        const int rotation = jsin.get_int();
+        elem.tile = memorized_terrain_tile( id, subtile, rotation );
         jsin.end_array();
     }
     jsin.start_array();
@@ -4663,12 +4661,12 @@ void submap::store( JsonOut &jsout ) const
     jsout.start_array();
     for( int j = 0; j < SEEY; j++ ) {
         for( int i = 0; i < SEEX; i++ ) {
-            if( itm[i][j].empty() ) {
+            if( !has_items( point( i, j ) ) ) {
                 continue;
             }
             jsout.write( i );
             jsout.write( j );
-            jsout.write( itm[i][j] );
+            jsout.write( get_items( point( i, j ) ) );
         }
     }
     jsout.end_array();
@@ -4809,13 +4807,13 @@ void submap::load( JsonIn &jsin, const std::string &member_name, int version )
                     if( tid == ter_t_rubble ) {
                         ter[i][j] = ter_id( "t_dirt" );
                         frn[i][j] = furn_id( "f_rubble" );
-                        itm[i][j].insert( rock );
-                        itm[i][j].insert( rock );
+                        get_items( point( i, j ) ).insert( rock );
+                        get_items( point( i, j ) ).insert( rock );
                     } else if( tid == ter_t_wreckage ) {
                         ter[i][j] = ter_id( "t_dirt" );
                         frn[i][j] = furn_id( "f_wreckage" );
-                        itm[i][j].insert( chunk );
-                        itm[i][j].insert( chunk );
+                        get_items( point( i, j ) ).insert( chunk );
+                        get_items( point( i, j ) ).insert( chunk );
                     } else if( tid == ter_t_ash ) {
                         ter[i][j] = ter_id( "t_dirt" );
                         frn[i][j] = furn_id( "f_ash" );
@@ -4888,11 +4886,11 @@ void submap::load( JsonIn &jsin, const std::string &member_name, int version )
             int j = jsin.get_int();
             const point p( i, j );
 
-            if( !jsin.read( itm[p.x][p.y], false ) ) {
+            if( !jsin.read( get_items( p ), false ) ) {
                 debugmsg( "Items array is corrupt in submap at: %s, skipping", p.to_string() );
             }
             // some portion could've been read even if error occurred
-            for( item &it : itm[p.x][p.y] ) {
+            for( item &it : get_items( p ) ) {
                 if( it.is_emissive() ) {
                     update_lum_add( p, it );
                 }
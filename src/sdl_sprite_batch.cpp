@@ -0,0 +1,112 @@
+#if defined(TILES)
+#include "sdl_sprite_batch.h"
+
+#include <cmath>
+#include <utility>
+
+#include "debug.h"
+
+void SpriteBatch::begin()
+{
+    active = true;
+}
+
+void SpriteBatch::end( const SDL_Renderer_Ptr &renderer )
+{
+    flush( renderer );
+    active = false;
+}
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+void SpriteBatch::flush( const SDL_Renderer_Ptr &renderer )
+{
+    if( indices.empty() ) {
+        return;
+    }
+    printErrorIf( SDL_RenderGeometry( renderer.get(), texture, vertices.data(),
+                                      static_cast<int>( vertices.size() ), indices.data(),
+                                      static_cast<int>( indices.size() ) ) != 0,
+                  "SDL_RenderGeometry failed" );
+    vertices.clear();
+    indices.clear();
+}
+
+int SpriteBatch::copy_ex( const SDL_Renderer_Ptr &renderer, SDL_Texture *const tex,
+                          const SDL_Rect &srcrect, const SDL_Rect &dstrect, const double angle,
+                          const SDL_RendererFlip flip )
+{
+    const int quarter_turns = static_cast<int>( std::lround( angle / 90.0 ) );
+    if( !active || quarter_turns * 90.0 != angle ) {
+        flush( renderer );
+        return SDL_RenderCopyEx( renderer.get(), tex, &srcrect, &dstrect, angle, nullptr, flip );
+    }
+    // The size is queried again for every new batch, a texture freed since the last one (say,
+    // by a tileset reload) may have been replaced by another one at the same address
+    if( tex != texture || indices.empty() ) {
+        flush( renderer );
+        int width = 0;
+        int height = 0;
+        if( SDL_QueryTexture( tex, nullptr, nullptr, &width, &height ) != 0 ) {
+            return -1;
+        }
+        texture = tex;
+        texture_size = { static_cast<float>( width ), static_cast<float>( height ) };
+    }
+
+    float u0 = srcrect.x / texture_size.x;
+    float u1 = ( srcrect.x + srcrect.w ) / texture_size.x;
+    float v0 = srcrect.y / texture_size.y;
+    float v1 = ( srcrect.y + srcrect.h ) / texture_size.y;
+    if( flip & SDL_FLIP_HORIZONTAL ) {
+        std::swap( u0, u1 );
+    }
+    if( flip & SDL_FLIP_VERTICAL ) {
+        std::swap( v0, v1 );
+    }
+
+    // Corners in clockwise order starting at the top left, relative to the center of the
+    // destination, which is what SDL_RenderCopyEx rotates around
+    const float half_w = dstrect.w / 2.0f;
+    const float half_h = dstrect.h / 2.0f;
+    const SDL_FPoint center = { dstrect.x + half_w, dstrect.y + half_h };
+    SDL_FPoint corners[4] = {
+        { -half_w, -half_h }, { half_w, -half_h }, { half_w, half_h }, { -half_w, half_h }
+    };
+    const SDL_FPoint tex_coords[4] = { { u0, v0 }, { u1, v0 }, { u1, v1 }, { u0, v1 } };
+    // Positive angles turn clockwise, y points down
+    for( int i = 0; i < ( ( quarter_turns % 4 ) + 4 ) % 4; i++ ) {
+        for( SDL_FPoint &corner : corners ) {
+            corner = { -corner.y, corner.x };
+        }
+    }
+
+    const int first = static_cast<int>( vertices.size() );
+    for( int i = 0; i < 4; i++ ) {
+        vertices.push_back( { { center.x + corners[i].x, center.y + corners[i].y },
+            { 255, 255, 255, 255 }, tex_coords[i]
+        } );
+    }
+    static const int quad_indices[6] = { 0, 1, 2, 0, 2, 3 };
+    for( const int i : quad_indices ) {
+        indices.push_back( first + i );
+    }
+    return 0;
+}
+
+#else
+
+void SpriteBatch::flush( const SDL_Renderer_Ptr & )
+{
+}
+
+int SpriteBatch::copy_ex( const SDL_Renderer_Ptr &renderer, SDL_Texture *const tex,
+                          const SDL_Rect &srcrect, const SDL_Rect &dstrect, const double angle,
+                          const SDL_RendererFlip flip )
+{
+    return SDL_RenderCopyEx( renderer.get(), tex, &srcrect, &dstrect, angle, nullptr, flip );
+}
+
+#endif
+
+#endif // TILES
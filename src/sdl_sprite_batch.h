@@ -0,0 +1,45 @@
+#pragma once
+#ifndef CATA_SRC_SDL_SPRITE_BATCH_H
+#define CATA_SRC_SDL_SPRITE_BATCH_H
+
+#if defined(TILES)
+#include <vector>
+
+#include "sdl_wrappers.h"
+
+/// Collects sprites that are copied from the same texture and submits them to the renderer
+/// with a single SDL_RenderGeometry call instead of one SDL_RenderCopyEx per sprite.
+///
+/// Sprites are drawn in the order they were queued. Queueing a sprite from another texture
+/// flushes the sprites queued so far, but anything drawn directly to the renderer needs an
+/// explicit @ref flush first. With SDL older than 2.0.18, which lacks SDL_RenderGeometry,
+/// sprites are always drawn right away.
+class SpriteBatch
+{
+    public:
+        /// Starts collecting sprites, until then @ref copy_ex draws them right away.
+        void begin();
+        /// Draws the collected sprites and stops collecting.
+        void end( const SDL_Renderer_Ptr &renderer );
+        /// Draws the collected sprites.
+        void flush( const SDL_Renderer_Ptr &renderer );
+
+        /// Same as SDL_RenderCopyEx with a null rotation center. Angles that are not a multiple
+        /// of 90 degrees are drawn right away.
+        int copy_ex( const SDL_Renderer_Ptr &renderer, SDL_Texture *tex,
+                     const SDL_Rect &srcrect, const SDL_Rect &dstrect, double angle,
+                     SDL_RendererFlip flip );
+
+    private:
+        bool active = false;
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+        SDL_Texture *texture = nullptr;
+        SDL_FPoint texture_size = { 0.0f, 0.0f };
+        std::vector<SDL_Vertex> vertices;
+        std::vector<int> indices;
+#endif
+};
+
+#endif // TILES
+
+#endif // CATA_SRC_SDL_SPRITE_BATCH_H
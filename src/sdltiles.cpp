@@ -149,7 +149,9 @@ using cata_cursesport::curseline;
 using cata_cursesport::cursecell;
 static std::vector<curseline> oversized_framebuffer;
 static std::vector<curseline> terminal_framebuffer;
-static std::weak_ptr<void> winBuffer; //tracking last drawn window to fix the framebuffer
+// The font the oversized framebuffer was last drawn with, its cells are only comparable
+// when drawn with the same font
+static const Font *oversized_framebuffer_font = nullptr;
 static int fontScaleBuffer; //tracking zoom levels to fix framebuffer w/tiles
 
 //***********************************
@@ -560,8 +562,12 @@ void set_displaybuffer_rendertarget()
 static void invalidate_framebuffer( std::vector<curseline> &framebuffer, const point &p, int width,
                                     int height )
 {
-    for( int j = 0, fby = p.y; j < height; j++, fby++ ) {
-        std::fill_n( framebuffer[fby].chars.begin() + p.x, width, cursecell( "" ) );
+    const int max_y = std::min( p.y + height, static_cast<int>( framebuffer.size() ) );
+    for( int fby = std::max( p.y, 0 ); fby < max_y; fby++ ) {
+        std::vector<cursecell> &chars = framebuffer[fby].chars;
+        const int begin = clamp( p.x, 0, static_cast<int>( chars.size() ) );
+        const int end = clamp( p.x + width, begin, static_cast<int>( chars.size() ) );
+        std::fill( chars.begin() + begin, chars.begin() + end, cursecell( "" ) );
     }
 }
 
@@ -659,6 +665,7 @@ void clear_window_area( const catacurses::window &win_ )
     cata_cursesport::WINDOW *const win = win_.get<cata_cursesport::WINDOW>();
     geometry->rect( renderer, point( win->pos.x * fontwidth, win->pos.y * fontheight ),
                     win->width * fontwidth, win->height * fontheight, color_as_sdl( catacurses::black ) );
+    invalidate_framebuffer( terminal_framebuffer, win->pos, win->width, win->height );
 }
 
 static cata::optional<std::pair<tripoint_abs_omt, std::string>> get_mission_arrow(
@@ -868,12 +875,17 @@ void cata_tiles::draw_om( const point &dest, const tripoint_abs_omt &center_abs_
         return tripoint( omp.raw().xy(), 0 );
     };
 
+    // Notes and vehicles are looked up once for the whole window, searching them for every
+    // drawn tile is linear in their count
+    const overmap_overlays overlays = blink ?
+                                      overmap_buffer.get_overlays( corner_NW, corner_SE.xy() ) :
+                                      overmap_overlays();
+
     for( int row = min_row; row < max_row; row++ ) {
         for( int col = min_col; col < max_col; col++ ) {
             const tripoint_abs_omt omp = corner_NW + point( col, row );
 
             const bool see = overmap_buffer.seen( omp );
-            const bool los = see && you.overmap_los( omp, sight_points );
             // the full string from the ter_id including _north etc.
             std::string id;
             int rotation = 0;
@@ -914,8 +926,9 @@ void cata_tiles::draw_om( const point &dest, const tripoint_abs_omt &center_abs_
                                              omp.raw(), 0, 0, lit_level::LIT, false );
                     }
                 }
-                const int horde_size = overmap_buffer.get_horde_size( omp );
-                if( showhordes && los && horde_size >= HORDE_VISIBILITY_SIZE ) {
+                // Line of sight is only checked where a horde would be displayed
+                const int horde_size = showhordes ? overmap_buffer.get_horde_size( omp ) : 0;
+                if( horde_size >= HORDE_VISIBILITY_SIZE && you.overmap_los( omp, sight_points ) ) {
                     // a little bit of hardcoded fallbacks for hordes
                     if( find_tile_with_season( id ) ) {
                         // NOLINTNEXTLINE(cata-translate-string-literal)
@@ -954,12 +967,12 @@ void cata_tiles::draw_om( const point &dest, const tripoint_abs_omt &center_abs_
 
             if( uistate.place_terrain || uistate.place_special ) {
                 // Highlight areas that already have been generated
-                if( MAPBUFFER.lookup_submap( project_to<coords::sm>( omp ) ) ) {
+                if( MAPBUFFER.submap_exists( project_to<coords::sm>( omp ) ) ) {
                     draw_from_id_string( "highlight", omp.raw(), 0, 0, lit_level::LIT, false );
                 }
             }
 
-            if( blink && overmap_buffer.has_vehicle( omp ) ) {
+            if( blink && overlays.has_vehicle( omp.xy() ) ) {
                 const std::string tile_id = overmap_buffer.get_vehicle_tile_id( omp );
                 if( find_tile_looks_like( tile_id, TILE_CATEGORY::OVERMAP_NOTE, "" ) ) {
                     draw_from_id_string( tile_id, TILE_CATEGORY::OVERMAP_NOTE,
@@ -972,13 +985,15 @@ void cata_tiles::draw_om( const point &dest, const tripoint_abs_omt &center_abs_
                 }
             }
 
-            if( blink && uistate.overmap_show_map_notes && overmap_buffer.has_note( omp ) ) {
+            const std::string *note_text = blink && uistate.overmap_show_map_notes ?
+                                           overlays.note( omp.xy() ) : nullptr;
+            if( note_text ) {
 
                 nc_color ter_color = c_black;
                 std::string ter_sym = " ";
                 // Display notes in all situations, even when not seen
                 std::tie( ter_sym, ter_color, std::ignore ) =
-                    overmap_ui::get_note_display_info( overmap_buffer.note( omp ) );
+                    overmap_ui::get_note_display_info( *note_text );
 
                 std::string note_name = "note_" + ter_sym + "_" + string_from_color( ter_color );
                 draw_from_id_string( note_name, TILE_CATEGORY::OVERMAP_NOTE, "overmap_note",
@@ -1220,17 +1235,10 @@ static bool draw_window( Font_Ptr &font, const catacurses::window &w, const poin
     }
 
     cata_cursesport::WINDOW *const win = w.get<cata_cursesport::WINDOW>();
-    //Keeping track of the last drawn window
-    const cata_cursesport::WINDOW *winBuffer = static_cast<cata_cursesport::WINDOW *>
-            ( ::winBuffer.lock().get() );
     if( !fontScaleBuffer ) {
         fontScaleBuffer = tilecontext->get_tile_width();
     }
     const int fontScale = tilecontext->get_tile_width();
-    //This creates a problem when map_font is different from the regular font
-    //Specifically when showing the overmap
-    //And in some instances of screen change, i.e. inventory.
-    bool oldWinCompatible = false;
 
     // clear the oversized buffer proportionally
     invalidate_framebuffer_proportion( win );
@@ -1242,33 +1250,51 @@ static bool draw_window( Font_Ptr &font, const catacurses::window &w, const poin
                                           terminal_framebuffer;
 
     /*
-    Let's try to keep track of different windows.
-    A number of windows are coexisting on the screen, so don't have to interfere.
-
-    g->w_terrain, g->w_minimap, g->w_HP, g->w_status, g->w_status2, g->w_messages,
-     g->w_location, and g->w_minimap, can be buffered if either of them was
-     the previous window.
-
-    g->w_overmap and g->w_omlegend are likewise.
-
-    Everything else works on strict equality because there aren't yet IDs for some of them.
+    The frame buffers hold what was last drawn at each cell of the screen, so a cell only
+    needs to be drawn again when it differs from that. This holds across windows, as long
+    as everything drawn by other means invalidates the cells it covers. The terrain and
+    overmap windows use their own frame buffer as their cells can have a different size,
+    and the cells of both are only comparable when drawn with the same font.
     */
-    if( g && ( w == g->w_terrain || w == g->w_minimap ) ) {
-        if( winBuffer == g->w_terrain || winBuffer == g->w_minimap ) {
-            oldWinCompatible = true;
-        }
-    } else if( g && ( w == g->w_overmap || w == g->w_omlegend ) ) {
-        if( winBuffer == g->w_overmap || winBuffer == g->w_omlegend ) {
-            oldWinCompatible = true;
-        }
-    } else {
-        if( win == winBuffer ) {
-            oldWinCompatible = true;
-        }
+    if( use_oversized_framebuffer && oversized_framebuffer_font != font.get() ) {
+        invalidate_framebuffer( oversized_framebuffer );
+        oversized_framebuffer_font = font.get();
     }
+    const bool framebuffer_valid = fontScale == fontScaleBuffer;
 
     // TODO: Get this from UTF system to make sure it is exactly the kind of space we need
     static const std::string space_string = " ";
+    const bool draw_ascii_lines_option = get_option<bool>( "USE_DRAW_ASCII_LINES_ROUTINE" );
+
+    // The background of each line is filled in runs of the same color before its glyphs
+    // are drawn on top, instead of a fill for every cell
+    struct glyph_to_draw {
+        const cursecell *cell;
+        point pos;
+        bool ascii_line;
+        unsigned char line_id;
+    };
+    std::vector<glyph_to_draw> glyphs;
+    SDL_Rect bg_run{ 0, 0, 0, 0 };
+    catacurses::base_color bg_run_color = catacurses::black;
+    const auto flush_bg_run = [&]() {
+        if( bg_run.w > 0 ) {
+            geometry->rect( renderer, bg_run, color_as_sdl( bg_run_color ) );
+            bg_run.w = 0;
+        }
+    };
+    const auto add_bg = [&]( const point & draw, const int cell_width,
+    const catacurses::base_color color ) {
+        if( bg_run.w > 0 && ( draw.x != bg_run.x + bg_run.w || draw.y != bg_run.y ||
+                              color != bg_run_color ) ) {
+            flush_bg_run();
+        }
+        if( bg_run.w == 0 ) {
+            bg_run = SDL_Rect{ draw.x, draw.y, 0, font->height };
+            bg_run_color = color;
+        }
+        bg_run.w += cell_width;
+    };
 
     bool update = false;
     for( int j = 0; j < win->height; j++ ) {
@@ -1284,6 +1310,7 @@ static bool draw_window( Font_Ptr &font, const catacurses::window &w, const poin
 
         update = true;
         win->line[j].touched = false;
+        glyphs.clear();
         for( int i = 0; i < win->width; i++ ) {
             const int fbx = win->pos.x + i;
             if( fbx >= static_cast<int>( framebuffer[fby].chars.size() ) ) {
@@ -1303,7 +1330,7 @@ static bool draw_window( Font_Ptr &font, const catacurses::window &w, const poin
             // TODO: handle caching when drawing normal windows over graphical tiles
             cursecell &oldcell = framebuffer[fby].chars[fbx];
 
-            if( oldWinCompatible && cell == oldcell && fontScale == fontScaleBuffer ) {
+            if( framebuffer_valid && cell == oldcell ) {
                 continue;
             }
             oldcell = cell;
@@ -1314,19 +1341,16 @@ static bool draw_window( Font_Ptr &font, const catacurses::window &w, const poin
 
             // Spaces are used a lot, so this does help noticeably
             if( cell.ch == space_string ) {
-                geometry->rect( renderer, draw, font->width, font->height,
-                                color_as_sdl( cell.BG ) );
+                add_bg( draw, font->width, cell.BG );
                 continue;
             }
             const int codepoint = UTF8_getch( cell.ch );
-            const catacurses::base_color FG = cell.FG;
-            const catacurses::base_color BG = cell.BG;
             int cw = ( codepoint == UNKNOWN_UNICODE ) ? 1 : utf8_width( cell.ch );
             if( cw < 1 ) {
                 // utf8_width() may return a negative width
                 continue;
             }
-            bool use_draw_ascii_lines_routine = get_option<bool>( "USE_DRAW_ASCII_LINES_ROUTINE" );
+            bool use_draw_ascii_lines_routine = draw_ascii_lines_option;
             unsigned char uc = static_cast<unsigned char>( cell.ch[0] );
             switch( codepoint ) {
                 case LINE_XOXO_UNICODE:
@@ -1369,18 +1393,32 @@ static bool draw_window( Font_Ptr &font, const catacurses::window &w, const poin
                     use_draw_ascii_lines_routine = false;
                     break;
             }
-            geometry->rect( renderer, draw, font->width * cw, font->height,
-                            color_as_sdl( BG ) );
-            if( use_draw_ascii_lines_routine ) {
-                font->draw_ascii_lines( renderer, geometry, uc, draw, FG );
+            add_bg( draw, font->width * cw, cell.BG );
+            glyphs.push_back( { &cell, draw, use_draw_ascii_lines_routine, uc } );
+        }
+        flush_bg_run();
+        // Glyphs stay within their cells, so drawing them after all backgrounds of the
+        // line gives the same result
+        for( const glyph_to_draw &glyph : glyphs ) {
+            if( glyph.ascii_line ) {
+                font->draw_ascii_lines( renderer, geometry, glyph.line_id, glyph.pos,
+                                        glyph.cell->FG );
             } else {
-                font->OutputChar( renderer, geometry, cell.ch, draw, FG );
+                font->OutputChar( renderer, geometry, glyph.cell->ch, glyph.pos, glyph.cell->FG );
             }
         }
     }
+    if( use_oversized_framebuffer && update ) {
+        // The special font draws over cells of the terminal font, which have to be drawn
+        // again when something is shown there later
+        const point term_pos( offset.x / fontwidth, offset.y / fontheight );
+        const point term_end( divide_round_up( offset.x + win->width * font->width, fontwidth ),
+                              divide_round_up( offset.y + win->height * font->height, fontheight ) );
+        invalidate_framebuffer( terminal_framebuffer, term_pos, term_end.x - term_pos.x,
+                                term_end.y - term_pos.y );
+    }
     win->draw = false; //We drew the window, mark it as so
-    //Keeping track of last drawn window and tilemode zoom level
-    ::winBuffer = w.weak_ptr();
+    //Keeping track of tilemode zoom level
     fontScaleBuffer = tilecontext->get_tile_width();
 
     return update;
@@ -1482,6 +1520,7 @@ void cata_cursesport::curses_drawwindow( const catacurses::window &w )
 
         invalidate_framebuffer( terminal_framebuffer, win->pos,
                                 TERRAIN_WINDOW_TERM_WIDTH, TERRAIN_WINDOW_TERM_HEIGHT );
+        oversized_framebuffer_font = nullptr;
 
         update = true;
     } else if( g && w == g->w_terrain && map_font ) {
@@ -1508,11 +1547,19 @@ void cata_cursesport::curses_drawwindow( const catacurses::window &w )
                             TERRAIN_WINDOW_HEIGHT * map_font->height + partial_height,
                             color_as_sdl( catacurses::black ) );
         }
+        if( partial_width > 0 || partial_height > 0 ) {
+            // The gaps cover terminal cells that draw_window doesn't know about
+            invalidate_framebuffer( terminal_framebuffer, win->pos,
+                                    TERRAIN_WINDOW_TERM_WIDTH, TERRAIN_WINDOW_TERM_HEIGHT );
+        }
         // Special font for the terrain window
         update = draw_window( map_font, w );
     } else if( g && w == g->w_overmap && use_tiles && use_tiles_overmap ) {
         overmap_tilecontext->draw_om( win->pos, overmap_ui::redraw_info.center,
                                       overmap_ui::redraw_info.blink );
+        invalidate_framebuffer( terminal_framebuffer, win->pos,
+                                OVERMAP_WINDOW_TERM_WIDTH, OVERMAP_WINDOW_TERM_HEIGHT );
+        oversized_framebuffer_font = nullptr;
         update = true;
     } else if( g && w == g->w_overmap && overmap_font ) {
         // Special font for the terrain window
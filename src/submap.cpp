@@ -27,6 +27,8 @@ void maptile_soa<sx, sy>::swap_soa_tile( const point &p1, const point &p2 )
     std::swap( rad[p1.x][p1.y], rad[p2.x][p2.y] );
 }
 
+const cata::colony<item> submap::no_items;
+
 submap::submap()
 {
     std::uninitialized_fill_n( &ter[0][0], elements, t_null );
@@ -231,6 +233,24 @@ bool submap::is_open_air( const point &p ) const
     return t->trap == tr_ledge;
 }
 
+bool submap::is_plain_uniform() const
+{
+    if( !is_uniform || field_count != 0 || temperature != 0 || !cosmetics.empty() ||
+        !active_items.empty() || !spawns.empty() || !vehicles.empty() ||
+        !partial_constructions.empty() || camp || !computers.empty() || legacy_computer ) {
+        return false;
+    }
+    for( int x = 0; x < SEEX; ++x ) {
+        for( int y = 0; y < SEEY; ++y ) {
+            if( ter[x][y] != ter[0][0] || frn[x][y] != f_null || trp[x][y] != tr_null ||
+                rad[x][y] != 0 || lum[x][y] != 0 || has_items( point( x, y ) ) ) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 void submap::rotate( int turns )
 {
     turns = turns % 4;
@@ -385,7 +405,7 @@ void submap::update_lum_rem( const point &p, const item &i )
     // Have to scan through all items to be sure removing i will actually lower
     // the count below 255.
     int count = 0;
-    for( const item &it : itm[p.x][p.y] ) {
+    for( const item &it : get_items( p ) ) {
         if( it.is_emissive() ) {
             count++;
         }
@@ -58,7 +58,8 @@ struct maptile_soa {
     ter_id             ter[sx][sy];  // Terrain on each square
     furn_id            frn[sx][sy];  // Furniture on each square
     std::uint8_t       lum[sx][sy];  // Number of items emitting light on each square
-    cata::colony<item> itm[sx][sy];  // Items on each square
+    // Items on each square, allocated the first time a tile is given items
+    std::unique_ptr<cata::colony<item>> itm[sx][sy];
     field              fld[sx][sy];  // Field on each square
     trap_id            trp[sx][sy];  // Trap on each square
     int                rad[sx][sy];  // Irradiation of each square
@@ -181,12 +182,25 @@ class submap : maptile_soa<SEEX, SEEY>
         void update_lum_rem( const point &p, const item &i );
 
         // TODO: Replace this as it essentially makes itm public
+        // Allocates the item stack of the tile if it has none yet; stacks are never freed
+        // afterwards, so references and iterators into them stay valid like before.
         cata::colony<item> &get_items( const point &p ) {
-            return itm[p.x][p.y];
+            std::unique_ptr<cata::colony<item>> &stack = itm[p.x][p.y];
+            if( !stack ) {
+                stack = std::make_unique<cata::colony<item>>();
+            }
+            return *stack;
         }
 
         const cata::colony<item> &get_items( const point &p ) const {
-            return itm[p.x][p.y];
+            const std::unique_ptr<cata::colony<item>> &stack = itm[p.x][p.y];
+            return stack ? *stack : no_items;
+        }
+
+        /** Whether the tile holds any items, without allocating its item stack. */
+        bool has_items( const point &p ) const {
+            const std::unique_ptr<cata::colony<item>> &stack = itm[p.x][p.y];
+            return stack && !stack->empty();
         }
 
         // TODO: Replace this as it essentially makes fld public
@@ -250,6 +264,12 @@ class submap : maptile_soa<SEEX, SEEY>
 
         bool is_open_air( const point & ) const;
 
+        /**
+         * Whether this submap is uniform and holds nothing but its terrain, so it
+         * can be recreated from the terrain id alone.
+         */
+        bool is_plain_uniform() const;
+
         void rotate( int turns );
         void mirror( bool horizontally );
 
@@ -284,6 +304,8 @@ class submap : maptile_soa<SEEX, SEEY>
         void update_legacy_computer();
 
         static constexpr size_t elements = SEEX * SEEY;
+        // Returned by the const get_items() for tiles whose item stack was never allocated
+        static const cata::colony<item> no_items;
 };
 
 /**
@@ -1,5 +1,6 @@
 #include "ui_manager.h"
 
+#include <chrono>
 #include <functional>
 #include <iterator>
 #include <vector>
@@ -22,6 +23,8 @@ static bool restart_redrawing = false;
 static cata::optional<SDL_Rect> prev_clip_rect;
 #endif
 static ui_stack_t ui_stack;
+// When the UIs were last asked to redraw, for pacing redraws that follow the simulation
+static std::chrono::steady_clock::time_point last_frame_time;
 
 ui_adaptor::ui_adaptor() : disabling_uis_below( false ), is_debug_message_ui( false ),
     invalidated( false ), deferred_resize( false )
@@ -322,6 +325,8 @@ void ui_adaptor::redraw()
 
 void ui_adaptor::redraw_invalidated()
 {
+    // Counted even when nothing is drawn, so frame pacing works the same in tests
+    last_frame_time = std::chrono::steady_clock::now();
     if( test_mode || ui_stack.empty() ) {
         return;
     }
@@ -474,4 +479,14 @@ void screen_resized()
     ui_adaptor::screen_resized();
 }
 
+bool frame_due( const int max_fps )
+{
+    if( max_fps <= 0 ) {
+        return true;
+    }
+    const std::chrono::steady_clock::duration frame_time =
+        std::chrono::steady_clock::duration( std::chrono::seconds( 1 ) ) / max_fps;
+    return std::chrono::steady_clock::now() - last_frame_time >= frame_time;
+}
+
 } // namespace ui_manager
@@ -276,6 +276,15 @@ void redraw_invalidated();
  * Not supposed to be directly called by the user.
  **/
 void screen_resized();
+/**
+ * Frame pacing for redraws that follow the simulation instead of player input,
+ * e.g. while waiting, sleeping, crafting or auto-travelling.
+ * Returns true if at least 1 / max_fps seconds have passed since the UIs were last
+ * redrawn. While it returns false the simulation is ahead of the screen, and the
+ * caller should keep simulating turns and skip the redraw. A max_fps of 0 or less
+ * means no limit.
+ **/
+bool frame_due( int max_fps );
 } // namespace ui_manager
 
 #endif // CATA_SRC_UI_MANAGER_H
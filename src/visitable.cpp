@@ -485,6 +485,9 @@ VisitResponse map_cursor::visit_items(
     }
 
     // skip inaccessible items
+    if( !here.has_items( p ) ) {
+        return VisitResponse::NEXT;
+    }
     if( here.has_flag( ter_furn_flag::TFLAG_SEALED, p ) &&
         !here.has_flag( ter_furn_flag::TFLAG_LIQUIDCONT, p ) ) {
         return VisitResponse::NEXT;
@@ -804,8 +807,9 @@ static int charges_of_internal( const T &self, const M &main, const itype_id &id
     bool found_tool_with_UPS = false;
     bool found_bionic_tool = false;
     self.visit_items( [&]( const item * e, item * ) {
-        if( filter( *e ) && ( id == e->typeId() || ( in_tools && id == e->ammo_current() ) ) &&
-            !e->is_broken() ) {
+        // cheapest checks first, filter may be arbitrarily expensive
+        if( ( id == e->typeId() || ( in_tools && id == e->ammo_current() ) ) && !e->is_broken() &&
+            filter( *e ) ) {
             if( id != itype_UPS_off ) {
                 if( e->count_by_charges() ) {
                     qty = sum_no_wrap( qty, e->charges );
@@ -949,9 +953,11 @@ static int amount_of_internal( const T &self, const itype_id &id, bool pseudo, i
                                const std::function<bool( const item & )> &filter )
 {
     int qty = 0;
-    self.visit_items( [&qty, &id, &pseudo, &limit, &filter]( const item * e, item * ) {
-        if( !e->has_flag( STATIC( flag_id( "ITEM_BROKEN" ) ) ) &&
-            ( id == STATIC( itype_id( "any" ) ) || e->typeId() == id ) && filter( *e ) &&
+    const bool any = id == STATIC( itype_id( "any" ) );
+    self.visit_items( [&qty, &id, any, &pseudo, &limit, &filter]( const item * e, item * ) {
+        // compare the type before testing flags, which looks into the item's pockets
+        if( ( any || e->typeId() == id ) &&
+            !e->has_flag( STATIC( flag_id( "ITEM_BROKEN" ) ) ) && filter( *e ) &&
             ( pseudo || !e->has_flag( STATIC( flag_id( "PSEUDO" ) ) ) ) ) {
             qty = sum_no_wrap( qty, 1 );
         }
@@ -1,5 +1,7 @@
 #include "widget.h"
 
+#include <unordered_map>
+
 #include "character_martial_arts.h"
 #include "color.h"
 #include "condition.h"
@@ -22,6 +24,23 @@ const static std::string default_separator = ": ";
 namespace
 {
 generic_factory<widget> widget_factory( "widgets" );
+
+// Last text laid out by a widget that renders from its value only, along with every input
+// that went into it. Widgets are copied before being laid out, so this is kept by id.
+struct widget_layout_cache {
+    int value = 0;
+    unsigned int max_width = 0;
+    int label_width = 0;
+    bool skip_pad = false;
+    int width = 0;
+    int height = 0;
+    int var_min = 0;
+    int var_max = 0;
+    std::pair<int, int> var_norm;
+    int lang_version = 0;
+    std::string text;
+};
+std::unordered_map<widget_id, widget_layout_cache> widget_layout_caches;
 } // namespace
 
 template<>
@@ -44,6 +63,7 @@ void widget::load_widget( const JsonObject &jo, const std::string &src )
 void widget::reset()
 {
     widget_factory.reset();
+    widget_layout_caches.clear();
 }
 
 const std::vector<widget> &widget::get_all()
@@ -1036,6 +1056,16 @@ bool widget::uses_text_function() const
     }
 }
 
+bool widget::renders_from_value_only() const
+{
+    if( _style == "layout" || uses_text_function() || has_flag( json_flag_W_DYNAMIC_HEIGHT ) ) {
+        return false;
+    }
+    return std::none_of( _clauses.begin(), _clauses.end(), []( const widget_clause & wp ) {
+        return wp.has_condition;
+    } );
+}
+
 // Simple workaround from the copied widget from the panel to set the widget's height globally
 static void set_height_for_widget( const widget_id &id, int height )
 {
@@ -1641,6 +1671,50 @@ static std::string append_line( const std::string &line, bool first_row, int max
     return ret;
 }
 
+// Single-line layouts are trimmed to fit max_width, multi-line ones are left as they are
+static std::string trim_layout( const std::string &ret, const unsigned int max_width )
+{
+    return ret.find( '\n' ) != std::string::npos || max_width == 0 ?
+           ret : trim_by_length( ret, max_width );
+}
+
+std::string widget::layout_text( std::string shown, const unsigned int max_width,
+                                 const int label_width, const bool skip_pad )
+{
+    std::string ret;
+    // If nothing was printed, the widget never had a chance to adjust the height. Adjust it here.
+    if( shown.empty() && has_flag( json_flag_W_DYNAMIC_HEIGHT ) ) {
+        _height = 0;
+    }
+    // Let the calling func know that this widget should be skipped for rendering
+    if( has_flag( json_flag_W_DISABLED_WHEN_EMPTY ) &&
+        string_empty_or_whitespace( remove_color_tags( shown ) ) ) {
+        return "";
+    }
+    size_t strpos = 0;
+    int row_num = 0;
+    // For multi-line widgets, each line is separated by a '\n' character
+    while( ( strpos = shown.find( '\n' ) ) != std::string::npos && row_num < _height ) {
+        // Process line, including '\n'
+        ret += append_line( shown.substr( 0, strpos + 1 ), row_num == 0, max_width,
+                            has_flag( json_flag_W_LABEL_NONE ) ? translation() : _label,
+                            0, _separator, _text_align, _label_align, skip_pad );
+        // Delete used token
+        shown.erase( 0, strpos + 1 );
+        row_num++;
+    }
+    if( row_num < _height ) {
+        // Process last line, or first for single-line widgets
+        ret += append_line( shown, row_num == 0, max_width,
+                            has_flag( json_flag_W_LABEL_NONE ) ? translation() : _label,
+                            row_num == 0 && _pad_labels ? label_width : 0, _separator, _text_align, _label_align, skip_pad );
+    }
+    if( ret.back() == '\n' ) {
+        ret.pop_back();
+    }
+    return ret;
+}
+
 std::string widget::layout( const avatar &ava, unsigned int max_width, int label_width,
                             bool skip_pad )
 {
@@ -1676,7 +1750,7 @@ std::string widget::layout( const avatar &ava, unsigned int max_width, int label
             // Total widget width w/o padding
             const int total_widget_width = std::accumulate( wgts.begin(), wgts.end(), 0,
             [child_width]( int sum, const widget_id & wid ) {
-                widget cur_child = wid.obj();
+                const widget &cur_child = wid.obj();
                 return sum + ( cur_child._style == "layout" &&
                                cur_child._width > 0 ? cur_child._width : child_width );
             } );
@@ -1763,42 +1837,29 @@ std::string widget::layout( const avatar &ava, unsigned int max_width, int label
             // Set height for the final layout
             set_height_for_widget( id, h_max );
         }
+    } else if( !id.is_empty() && renders_from_value_only() ) {
+        set_default_var_range( ava );
+        const int value = get_var_value( ava );
+        const int lang_version = detail::get_current_language_version();
+        widget_layout_cache &cache = widget_layout_caches[id];
+        if( !cache.text.empty() && cache.value == value && cache.max_width == max_width &&
+            cache.label_width == label_width && cache.skip_pad == skip_pad &&
+            cache.width == _width && cache.height == _height && cache.var_min == _var_min &&
+            cache.var_max == _var_max && cache.var_norm == _var_norm &&
+            cache.lang_version == lang_version ) {
+            return cache.text;
+        }
+        ret = trim_layout( layout_text( color_value_string( value, max_width ), max_width,
+                                        label_width, skip_pad ), max_width );
+        cache = { value, max_width, label_width, skip_pad, _width, _height, _var_min, _var_max,
+                  _var_norm, lang_version, ret
+                };
+        return ret;
     } else {
         // Get displayed value (colorized)
-        std::string shown = show( ava, max_width );
-        // If nothing was printed, the widget never had a chance to adjust the height. Adjust it here.
-        if( shown.empty() && has_flag( json_flag_W_DYNAMIC_HEIGHT ) ) {
-            _height = 0;
-        }
-        // Let the calling func know that this widget should be skipped for rendering
-        if( has_flag( json_flag_W_DISABLED_WHEN_EMPTY ) &&
-            string_empty_or_whitespace( remove_color_tags( shown ) ) ) {
-            return "";
-        }
-        size_t strpos = 0;
-        int row_num = 0;
-        // For multi-line widgets, each line is separated by a '\n' character
-        while( ( strpos = shown.find( '\n' ) ) != std::string::npos && row_num < _height ) {
-            // Process line, including '\n'
-            ret += append_line( shown.substr( 0, strpos + 1 ), row_num == 0, max_width,
-                                has_flag( json_flag_W_LABEL_NONE ) ? translation() : _label,
-                                0, _separator, _text_align, _label_align, skip_pad );
-            // Delete used token
-            shown.erase( 0, strpos + 1 );
-            row_num++;
-        }
-        if( row_num < _height ) {
-            // Process last line, or first for single-line widgets
-            ret += append_line( shown, row_num == 0, max_width,
-                                has_flag( json_flag_W_LABEL_NONE ) ? translation() : _label,
-                                row_num == 0 && _pad_labels ? label_width : 0, _separator, _text_align, _label_align, skip_pad );
-        }
-        if( ret.back() == '\n' ) {
-            ret.pop_back();
-        }
+        ret = layout_text( show( ava, max_width ), max_width, label_width, skip_pad );
     }
-    return ret.find( '\n' ) != std::string::npos || max_width == 0 ?
-           ret : trim_by_length( ret, max_width );
+    return trim_layout( ret, max_width );
 }
 
 std::string format_widget_multiline( const std::vector<std::string> &keys, int max_height,
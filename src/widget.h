@@ -214,6 +214,9 @@ class widget
         bool was_loaded = false;
         const widget_clause *get_clause( const std::string &clause_id = "" ) const;
         std::vector<const widget_clause *> get_clauses() const;
+        // Pad and label the already colorized text of a non-layout widget (see layout)
+        std::string layout_text( std::string shown, unsigned int max_width, int label_width,
+                                 bool skip_pad );
 
     public:
         widget() = default;
@@ -315,6 +318,10 @@ class widget
         std::string color_text_function_string( const avatar &ava, unsigned int max_width );
         // Return true if the current _var is one which uses a description function
         bool uses_text_function() const;
+        // Return true if the rendered text depends only on the var value, its range and the
+        // width, so layout may reuse the previous text while those stay the same.
+        // Text functions and conditional clauses read arbitrary game state instead.
+        bool renders_from_value_only() const;
 
         // Evaluate and return the bound "var" associated value for an avatar
         int get_var_value( const avatar &ava ) const;
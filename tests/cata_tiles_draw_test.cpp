@@ -0,0 +1,137 @@
+#if defined(TILES)
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "avatar.h"
+#include "cata_catch.h"
+#include "cata_tiles.h"
+#include "game.h"
+#include "item.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "map_test_case.h"
+#include "options.h"
+#include "player_helpers.h"
+#include "point.h"
+#include "sdl_geometry.h"
+#include "sdl_wrappers.h"
+#include "type_id.h"
+
+static const furn_str_id furn_f_chair( "f_chair" );
+static const furn_str_id furn_f_table( "f_table" );
+
+static const itype_id itype_rock( "rock" );
+
+static const mtype_id mon_zombie( "mon_zombie" );
+
+static const ter_str_id ter_t_brick_wall( "t_brick_wall" );
+static const ter_str_id ter_t_door_c( "t_door_c" );
+static const ter_str_id ter_t_floor( "t_floor" );
+static const ter_str_id ter_t_window( "t_window" );
+
+using namespace map_test_case_common;
+using namespace map_test_case_common::tiles;
+
+static void set_up_draw_scene()
+{
+    clear_map();
+    clear_avatar();
+    set_time_to_day();
+
+    // A house with furniture, items and monsters around the avatar, so every sprite layer
+    // has something to draw.
+    map_test_case t;
+    t.setup = {
+        "                         ",
+        "   ###=####=####=###     ",
+        "   #.....#.....#...#   Z ",
+        "   #.hT..#.hT..#.r.#     ",
+        "   =.....+.....+...=     ",
+        "   #..r..#..u..#...#  Z  ",
+        "   #.hT..#.hT..#.r.#     ",
+        "   ###=####+####=###     ",
+        "                         ",
+        "     Z          Z        ",
+    };
+    t.anchor_char = 'u';
+    t.anchor_map_pos = get_avatar().pos();
+
+    map &here = get_map();
+    const auto set_furniture = [&here]( const furn_str_id & furn ) {
+        return [&here, furn]( map_test_case::tile tile ) {
+            here.ter_set( tile.p, ter_t_floor );
+            here.furn_set( tile.p, furn );
+            return true;
+        };
+    };
+    t.for_each_tile(
+        ifchar( ' ', noop ) ||
+        ifchar( 'u', ter_set( ter_t_floor ) ) ||
+        ifchar( '.', ter_set( ter_t_floor ) ) ||
+        ifchar( '#', ter_set( ter_t_brick_wall ) ) ||
+        ifchar( '=', ter_set( ter_t_window ) ) ||
+        ifchar( '+', ter_set( ter_t_door_c ) ) ||
+        ifchar( 'h', set_furniture( furn_f_chair ) ) ||
+        ifchar( 'T', set_furniture( furn_f_table ) ) ||
+    ifchar( 'r', [&here]( map_test_case::tile tile ) {
+        here.ter_set( tile.p, ter_t_floor );
+        here.add_item( tile.p, item( itype_rock ) );
+        return true;
+    } ) ||
+    ifchar( 'Z', []( map_test_case::tile tile ) {
+        g->place_critter_at( mon_zombie, tile.p );
+        return true;
+    } ) ||
+    fail );
+
+    const int zlev = get_avatar().posz();
+    here.invalidate_map_cache( zlev );
+    here.build_map_cache( zlev );
+    here.update_visibility_cache( zlev );
+}
+
+// Renders the map with a software renderer into an offscreen surface, so it needs neither
+// a display nor a GPU. The tileset comes from the TILES option, use
+// --option_overrides=TILES:<tileset> to benchmark another (e.g. isometric) tileset.
+TEST_CASE( "cata_tiles_draw_benchmark", "[.][tiles][benchmark]" )
+{
+    set_up_draw_scene();
+
+    const int width = 1280;
+    const int height = 720;
+    const SDL_Surface_Ptr surface = CreateRGBSurface( 0, width, height, 32, 0x00ff0000,
+                                    0x0000ff00, 0x000000ff, 0xff000000 );
+    REQUIRE( surface );
+    const SDL_Renderer_Ptr renderer( SDL_CreateSoftwareRenderer( surface.get() ) );
+    REQUIRE( renderer );
+    const GeometryRenderer_Ptr geometry = std::make_unique<DefaultGeometryRenderer>();
+    tileset_cache cache;
+    cata_tiles tiles( renderer, geometry, cache );
+    tiles.load_tileset( get_option<std::string>( "TILES" ) );
+
+    std::multimap<point, formatted_text> overlay_strings;
+    color_block_overlay_container color_blocks;
+    const tripoint center = get_avatar().pos();
+    const auto draw_frame = [&]() {
+        overlay_strings.clear();
+        color_blocks.second.clear();
+        tiles.draw( point_zero, center, width, height, overlay_strings, color_blocks );
+        return tiles.get_sprites_drawn();
+    };
+
+    // 16 is the default zoom level, lower values zoom out
+    for( const int scale : std::vector<int> { 4, 8, 16, 32 } ) {
+        tiles.set_draw_scale( scale );
+        const int sprites = draw_frame();
+        CHECK( sprites > 0 );
+        WARN( "zoom " << scale << ": " << sprites << " sprites per frame" );
+        BENCHMARK( "draw map at zoom " + std::to_string( scale ) ) {
+            return draw_frame();
+        };
+    }
+}
+
+#endif // TILES
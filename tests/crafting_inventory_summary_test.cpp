@@ -0,0 +1,44 @@
+#include "crafting_inventory_summary.h"
+
+#include "calendar.h"
+#include "cata_catch.h"
+#include "inventory.h"
+#include "item.h"
+#include "recipe.h"
+#include "type_id.h"
+
+static const itype_id itype_test_gum( "test_gum" );
+static const itype_id itype_test_halligan( "test_halligan" );
+
+static const quality_id qual_HAMMER( "HAMMER" );
+
+TEST_CASE( "crafting_inventory_summary_counts", "[crafting][inventory]" )
+{
+    inventory inv;
+    inv.add_item( item( "test_gum", calendar::turn_zero, item::default_charges_tag{} ) );
+    inv.add_item( item( "test_halligan" ) );
+    inv.add_item( item( "test_halligan" ) );
+
+    crafting_inventory_summary summary( inv );
+    const std::function<bool( const item & )> &filter =
+        summary.component_filter( recipe_filter_flags::none );
+    CHECK( &summary.component_filter( recipe_filter_flags::none ) == &filter );
+
+    // Remembered counts still honour the limit of each query
+    for( int i = 0; i < 2; ++i ) {
+        CHECK( summary.charges_of( itype_test_gum, INT_MAX, filter ) == 10 );
+        CHECK( summary.charges_of( itype_test_gum, 4, filter ) == 4 );
+        CHECK( summary.has_charges( itype_test_gum, 10, filter ) );
+        CHECK_FALSE( summary.has_charges( itype_test_gum, 11, filter ) );
+        CHECK( summary.amount_of( itype_test_halligan ) == 2 );
+        CHECK( summary.has_tools( itype_test_halligan, 2 ) );
+        CHECK_FALSE( summary.has_components( itype_test_halligan, 3, filter ) );
+    }
+    CHECK( summary.has_quality( qual_HAMMER, 2 ) );
+
+    // Queries with other filters are answered by the inventory itself
+    const auto no_halligan = []( const item & it ) {
+        return it.typeId() != itype_test_halligan;
+    };
+    CHECK( summary.amount_of( itype_test_halligan, true, INT_MAX, no_halligan ) == 0 );
+}
@@ -1915,3 +1915,27 @@ TEST_CASE( "recipes inherit rot of components properly", "[crafting][rot]" )
         }
     }
 }
+
+TEST_CASE( "crafting inventories of different queries are kept apart", "[crafting][inventory]" )
+{
+    clear_map();
+    Character &player_character = get_player_character();
+    clear_avatar();
+    player_character.i_add( item( "hammer" ) );
+    const tripoint nearby = player_character.pos() + tripoint_east;
+    get_map().add_item( nearby, item( "rock" ) );
+
+    const inventory &carried_only = player_character.crafting_inventory( tripoint_zero, -1 );
+    const inventory &with_map = player_character.crafting_inventory();
+    CHECK( carried_only.amount_of( itype_id( "hammer" ) ) == 1 );
+    CHECK( with_map.amount_of( itype_id( "hammer" ) ) == 1 );
+    CHECK( carried_only.amount_of( itype_id( "rock" ) ) == 0 );
+    CHECK( with_map.amount_of( itype_id( "rock" ) ) == 1 );
+    // Asking again hands back the same inventories without rebuilding them
+    CHECK( &player_character.crafting_inventory( tripoint_zero, -1 ) == &carried_only );
+    CHECK( &player_character.crafting_inventory() == &with_map );
+
+    player_character.i_add( item( "hammer" ) );
+    player_character.invalidate_crafting_inventory();
+    CHECK( player_character.crafting_inventory().amount_of( itype_id( "hammer" ) ) == 2 );
+}
@@ -105,4 +105,24 @@ TEST_CASE( "fold-string" )
         };
         check_equal( folded.begin(), folded.end(), expected.begin(), expected.end() );
     }
+
+    SECTION( "Case 6 - test folding the same text again" ) {
+        const std::string text = "Lorem ipsum dolor sit amet, consectetur adipiscing elit.";
+        const std::vector<std::string> first = foldstring( text, 17 );
+        CHECK( foldstring( text, 17 ) == first );
+        // Other widths and split characters are folded separately
+        const auto expected_wide = {
+            "Lorem ipsum dolor sit amet, ",
+            "consectetur adipiscing elit.",
+        };
+        const std::vector<std::string> wide = foldstring( text, 28 );
+        check_equal( wide.begin(), wide.end(), expected_wide.begin(), expected_wide.end() );
+        const auto expected_split = {
+            "Lorem ipsum dolor sit amet,",
+            "consectetur adipiscing elit.",
+        };
+        const std::vector<std::string> split = foldstring( text, 29, ',' );
+        check_equal( split.begin(), split.end(), expected_split.begin(), expected_split.end() );
+        CHECK( foldstring( text, 17 ) == first );
+    }
 }
@@ -6,6 +6,7 @@
 #include <utility>
 #include <vector>
 
+#include "calendar.h"
 #include "cata_catch.h"
 #include "flag.h"
 #include "item.h"
@@ -261,3 +262,25 @@ TEST_CASE( "Event-based item spawns do not spawn outside event", "[item_group]"
         CHECK( items[0].typeId() == test_rock );
     }
 }
+
+TEST_CASE( "Distribution groups spawn entries by their weight", "[item_group]" )
+{
+    const itype_id test_rock( "test_rock" );
+    Item_group group( Item_group::G_DISTRIBUTION, 100, 0, 0, "test distribution" );
+    group.add_item_entry( test_rock, 10 );
+    group.add_item_entry( itype_match, 30 );
+    const Item_spawn_data &spawn = group;
+
+    int rocks = 0;
+    for( int i = 0; i < 4000; ++i ) {
+        const item it = spawn.create_single( calendar::turn );
+        REQUIRE( ( it.typeId() == test_rock || it.typeId() == itype_match ) );
+        rocks += it.typeId() == test_rock;
+    }
+    CHECK( rocks == Approx( 1000 ).margin( 150 ) );
+
+    group.remove_item( itype_match );
+    for( int i = 0; i < 100; ++i ) {
+        CHECK( spawn.create_single( calendar::turn ).typeId() == test_rock );
+    }
+}
@@ -5,6 +5,7 @@
 #include <initializer_list>
 #include <limits>
 #include <memory>
+#include <sstream>
 #include <vector>
 
 #include "avatar.h"
@@ -15,6 +16,7 @@
 #include "item_factory.h"
 #include "item_pocket.h"
 #include "itype.h"
+#include "json.h"
 #include "math_defines.h"
 #include "monstergenerator.h"
 #include "mtype.h"
@@ -316,6 +318,70 @@ TEST_CASE( "item variables round-trip accurately", "[item]" )
     CHECK( i.get_var( "C", tripoint() ) == tripoint( 2, 3, 4 ) );
 }
 
+TEST_CASE( "item variables keep their saved text form", "[item]" )
+{
+    item i( "water" );
+    i.set_var( "int", 17 );
+    i.set_var( "double", 0.125 );
+    i.set_var( "text", "007" );
+    i.set_var( "point", tripoint( 2, 3, 4 ) );
+    CHECK( i.get_var( "int" ) == "17" );
+    CHECK( i.get_var( "double" ) == "0.125000" );
+    CHECK( i.get_var( "text", 0 ) == 7 );
+
+    std::ostringstream os;
+    JsonOut jsout( os );
+    i.serialize( jsout );
+    std::istringstream is( os.str() );
+    JsonIn jsin( is );
+    item loaded;
+    loaded.deserialize( jsin.get_object() );
+
+    CHECK( loaded.get_var( "int", 0 ) == 17 );
+    CHECK( loaded.get_var( "double", 0.0 ) == 0.125 );
+    CHECK( loaded.get_var( "text" ) == "007" );
+    CHECK( loaded.get_var( "point", tripoint_zero ) == tripoint( 2, 3, 4 ) );
+    CHECK( loaded.stacks_with( i ) );
+
+    // Numbers and equal text are the same value for stacking
+    loaded.set_var( "int", "17" );
+    CHECK( loaded.stacks_with( i ) );
+    loaded.set_var( "double", 0.1250001 );
+    CHECK( loaded.stacks_with( i ) );
+    loaded.set_var( "int", 18 );
+    CHECK_FALSE( loaded.stacks_with( i ) );
+}
+
+TEST_CASE( "item flags can be set and unset individually", "[item][flag]" )
+{
+    item i( "water" );
+    const std::vector<json_flag> &all_flags = json_flag::get_all();
+    // Enough flags to need more than the inline word of the bitset
+    REQUIRE( all_flags.size() > 64 );
+
+    for( const json_flag &f : all_flags ) {
+        CAPTURE( f.id.str() );
+        const bool on_type = i.type->has_flag( f.id );
+        CHECK( on_type == ( i.type->get_flags().count( f.id ) > 0 ) );
+        CHECK_FALSE( i.has_own_flag( f.id ) );
+        i.set_flag( f.id );
+        CHECK( i.has_own_flag( f.id ) );
+        CHECK( i.has_flag( f.id ) );
+    }
+    CHECK( i.get_flags().size() == all_flags.size() );
+
+    for( const json_flag &f : all_flags ) {
+        CAPTURE( f.id.str() );
+        i.unset_flag( f.id );
+        CHECK_FALSE( i.has_own_flag( f.id ) );
+        CHECK( i.has_flag( f.id ) == i.type->has_flag( f.id ) );
+    }
+
+    i.set_flag( json_flag_FILTHY );
+    i.unset_flags();
+    CHECK_FALSE( i.has_own_flag( json_flag_FILTHY ) );
+}
+
 TEST_CASE( "water affect items while swimming check", "[item][water][swimming]" )
 {
     avatar &guy = get_avatar();
@@ -40,7 +40,7 @@ TEST_CASE( "map_memory_defaults", "[map_memory]" )
     memory.prepare_region( p1, p2 );
     CHECK( memory.get_symbol( p1 ) == 0 );
     memorized_terrain_tile default_tile = memory.get_tile( p1 );
-    CHECK( default_tile.tile.empty() );
+    CHECK( default_tile.get_id().empty() );
     CHECK( default_tile.subtile == 0 );
     CHECK( default_tile.rotation == 0 );
 }
@@ -73,6 +73,51 @@ TEST_CASE( "map_memory_forgets", "[map_memory]" )
     memory.memorize_symbol( p3, 1 );
 }
 
+TEST_CASE( "map_memory_remembers_tiles", "[map_memory]" )
+{
+    map_memory memory;
+    memory.prepare_region( p1, p2 );
+    memory.memorize_tile( p1, "t_floor", 1, 2 );
+    memory.memorize_tile( p2, "vp_frame_vertical_2", 0, 3 );
+    const memorized_terrain_tile &t1 = memory.get_tile( p1 );
+    const memorized_terrain_tile &t2 = memory.get_tile( p2 );
+    CHECK( t1.get_id() == "t_floor" );
+    CHECK( t1.subtile == 1 );
+    CHECK( t1.rotation == 2 );
+    CHECK( t2.get_id() == "vp_frame_vertical_2" );
+    CHECK( t2.rotation == 3 );
+    CHECK( t1 == memorized_terrain_tile( "t_floor", 1, 2 ) );
+    CHECK( t1 != memorized_terrain_tile( "t_floor", 1, 1 ) );
+    CHECK( t1 != t2 );
+}
+
+TEST_CASE( "map_memory_submap_saves_tiles_by_id", "[map_memory]" )
+{
+    mm_submap sm;
+    sm.set_tile( point_zero, memorized_terrain_tile( "t_floor", 0, 0 ) );
+    sm.set_tile( point_east, memorized_terrain_tile( "t_floor", 0, 0 ) );
+    sm.set_tile( point_south, memorized_terrain_tile( "f_chair", 2, 1 ) );
+    sm.set_symbol( point_south, 'h' );
+
+    std::ostringstream os;
+    JsonOut jsout( os );
+    sm.serialize( jsout );
+    CHECK( os.str().find( "\"t_floor\"" ) != std::string::npos );
+
+    std::istringstream is( os.str() );
+    JsonIn jsin( is );
+    mm_submap loaded;
+    loaded.deserialize( jsin );
+    for( int y = 0; y < SEEY; y++ ) {
+        for( int x = 0; x < SEEX; x++ ) {
+            const point p( x, y );
+            CAPTURE( p );
+            CHECK( loaded.tile( p ) == sm.tile( p ) );
+            CHECK( loaded.symbol( p ) == sm.symbol( p ) );
+        }
+    }
+}
+
 // TODO: map memory save / load
 
 #include <chrono>
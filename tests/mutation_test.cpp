@@ -11,6 +11,8 @@
 #include "player_helpers.h"
 #include "type_id.h"
 
+static const json_character_flag json_flag_CANNIBAL( "CANNIBAL" );
+
 static const morale_type morale_perm_debug( "morale_perm_debug" );
 
 static const mutation_category_id mutation_category_ALPHA( "ALPHA" );
@@ -20,6 +22,7 @@ static const mutation_category_id mutation_category_LUPINE( "LUPINE" );
 static const mutation_category_id mutation_category_MOUSE( "MOUSE" );
 static const mutation_category_id mutation_category_RAPTOR( "RAPTOR" );
 
+static const trait_id trait_CANNIBAL( "CANNIBAL" );
 static const trait_id trait_EAGLEEYED( "EAGLEEYED" );
 static const trait_id trait_GOURMAND( "GOURMAND" );
 static const trait_id trait_SMELLY( "SMELLY" );
@@ -483,3 +486,17 @@ TEST_CASE( "Chance of bad mutations vs instability", "[mutations][instability]"
     }
 }
 
+TEST_CASE( "Trait flags follow gained and lost mutations", "[mutations][flags]" )
+{
+    Character &dummy = get_player_character();
+    clear_avatar();
+    REQUIRE( dummy.count_trait_flag( json_flag_CANNIBAL ) == 0 );
+
+    dummy.set_mutation( trait_CANNIBAL );
+    CHECK( dummy.count_trait_flag( json_flag_CANNIBAL ) == 1 );
+    CHECK( dummy.has_flag( json_flag_CANNIBAL ) );
+
+    dummy.unset_mutation( trait_CANNIBAL );
+    CHECK( dummy.count_trait_flag( json_flag_CANNIBAL ) == 0 );
+    CHECK_FALSE( dummy.has_flag( json_flag_CANNIBAL ) );
+}
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <memory>
 #include <vector>
 
@@ -88,6 +89,61 @@ TEST_CASE( "set_and_get_overmap_scents", "[overmap]" )
     REQUIRE( test_overmap->scent_at( { 75, 85, 0} ).initial_strength == 90 );
 }
 
+TEST_CASE( "overmap_terrain_index_follows_ter_set", "[overmap][terrain]" )
+{
+    std::unique_ptr<overmap> test_overmap = std::make_unique<overmap>( point_abs_om() );
+    const std::vector<std::pair<std::string, ot_match_type>> cabins = {
+        { "cabin", ot_match_type::type }
+    };
+    const tripoint_om_omt first( 10, 20, 0 );
+    const tripoint_om_omt second( 30, 40, 0 );
+
+    // The first search builds the index, later changes must update it.
+    test_overmap->ter_set( first, oter_cabin_north.id() );
+    CHECK( test_overmap->find_all_omt( cabins ) == std::vector<tripoint_om_omt> { first } );
+
+    test_overmap->ter_set( second, oter_cabin_east.id() );
+    std::vector<tripoint_om_omt> found = test_overmap->find_all_omt( cabins );
+    CHECK( found.size() == 2 );
+    CHECK( std::find( found.begin(), found.end(), second ) != found.end() );
+
+    test_overmap->ter_set( first, test_overmap->ter( tripoint_om_omt( 0, 0, 0 ) ) );
+    CHECK( test_overmap->find_all_omt( cabins ) == std::vector<tripoint_om_omt> { second } );
+
+    // The default terrain of a z-level is found by falling back to a scan.
+    const oter_id &default_terrain = test_overmap->ter( tripoint_om_omt( 0, 0, 0 ) );
+    found = test_overmap->find_all_omt( { { default_terrain.id().str(), ot_match_type::exact } } );
+    CHECK( found.size() == static_cast<size_t>( OMAPX * OMAPY - 1 ) );
+    CHECK( std::find( found.begin(), found.end(), second ) == found.end() );
+}
+
+TEST_CASE( "overmap_overlays_gather_notes_in_area", "[overmap]" )
+{
+    overmap_buffer.clear();
+    // The area spans the border between two overmaps
+    const tripoint_abs_omt corner_nw( -5, 0, 0 );
+    const point_abs_omt corner_se( 5, 10 );
+    const tripoint_abs_omt inside_west( -1, 5, 0 );
+    const tripoint_abs_omt inside_east( 5, 10, 0 );
+    const tripoint_abs_omt outside( 6, 10, 0 );
+    const tripoint_abs_omt other_level( 0, 5, 1 );
+    overmap_buffer.add_note( inside_west, "west" );
+    overmap_buffer.add_note( inside_east, "east" );
+    overmap_buffer.add_note( outside, "outside" );
+    overmap_buffer.add_note( other_level, "above" );
+
+    const overmap_overlays overlays = overmap_buffer.get_overlays( corner_nw, corner_se );
+    CHECK( overlays.notes.size() == 2 );
+    REQUIRE( overlays.note( inside_west.xy() ) );
+    CHECK( *overlays.note( inside_west.xy() ) == "west" );
+    REQUIRE( overlays.note( inside_east.xy() ) );
+    CHECK( *overlays.note( inside_east.xy() ) == "east" );
+    CHECK( !overlays.note( outside.xy() ) );
+    CHECK( !overlays.note( other_level.xy() ) );
+    CHECK( !overlays.has_vehicle( inside_west.xy() ) );
+    overmap_buffer.clear();
+}
+
 TEST_CASE( "default_overmap_generation_always_succeeds", "[overmap][slow]" )
 {
     int overmaps_to_construct = 10;
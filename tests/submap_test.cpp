@@ -1,7 +1,12 @@
 #include "cata_catch.h"
 #include "submap.h"
 
+#include "calendar.h"
+#include "coordinates.h"
+#include "field_type.h"
 #include "game_constants.h"
+#include "item.h"
+#include "mapbuffer.h"
 #include "point.h"
 #include "type_id.h"
 
@@ -115,3 +120,103 @@ TEST_CASE( "submap rotation2", "[submap]" )
         }
     }
 }
+
+TEST_CASE( "submap plain uniformity", "[submap]" )
+{
+    submap sm;
+    sm.is_uniform = true;
+    sm.set_all_ter( ter_id( 1 ) );
+    CHECK( sm.is_plain_uniform() );
+
+    SECTION( "a submap with graffiti is not plain" ) {
+        sm.insert_cosmetic( point_zero, "GRAFFITI", "kilroy was here" );
+        CHECK_FALSE( sm.is_plain_uniform() );
+    }
+    SECTION( "a submap with a changed tile is not plain" ) {
+        sm.set_ter( point_south_east, ter_id( 2 ) );
+        CHECK_FALSE( sm.is_plain_uniform() );
+    }
+}
+
+TEST_CASE( "submap item stacks", "[submap]" )
+{
+    submap sm;
+    const submap &const_sm = sm;
+    CHECK_FALSE( sm.has_items( point_south ) );
+    CHECK( const_sm.get_items( point_south ).empty() );
+
+    sm.get_items( point_south ).insert( item( "rock" ) );
+    CHECK( sm.has_items( point_south ) );
+    CHECK( const_sm.get_items( point_south ).size() == 1 );
+    CHECK_FALSE( sm.has_items( point_east ) );
+
+    sm.rotate( 2 );
+    CHECK_FALSE( sm.has_items( point_south ) );
+    CHECK( sm.has_items( point_south.rotate( 2, { SEEX, SEEY } ) ) );
+}
+
+static void add_uniform_quad( mapbuffer &buffer, const tripoint_abs_sm &quad_origin,
+                              const ter_id &ter )
+{
+    for( const point &offset : {
+             point_zero, point_south, point_east, point_south_east
+         } ) {
+        std::unique_ptr<submap> sm = std::make_unique<submap>();
+        sm->is_uniform = true;
+        sm->set_all_ter( ter );
+        sm->last_touched = calendar::turn_zero + 1_hours;
+        REQUIRE( buffer.add_submap( quad_origin + offset, sm ) );
+    }
+}
+
+TEST_CASE( "uniform submaps outside the reality bubble are compacted", "[submap]" )
+{
+    // Far away from the reality bubble, in OMT aligned submap coordinates
+    const tripoint_abs_sm quad_origin( 1000, 1000, 0 );
+    const ter_id ter( 1 );
+    mapbuffer buffer;
+    add_uniform_quad( buffer, quad_origin, ter );
+
+    SECTION( "a plain quad is compacted and expanded again on lookup" ) {
+        buffer.compact_uniform_submaps( quad_origin );
+        CHECK( buffer.is_compacted( quad_origin + point_south_east ) );
+        const submap *sm = buffer.lookup_submap( quad_origin + point_south_east );
+        REQUIRE( sm != nullptr );
+        CHECK( sm->is_uniform );
+        CHECK( sm->get_ter( point_zero ) == ter );
+        CHECK( sm->get_ter( point( SEEX - 1, SEEY - 1 ) ) == ter );
+        CHECK( sm->last_touched == calendar::turn_zero + 1_hours );
+        // The whole quad is expanded together
+        CHECK_FALSE( buffer.is_compacted( quad_origin ) );
+    }
+
+    SECTION( "checking a compacted submap exists keeps it compacted" ) {
+        buffer.compact_uniform_submaps( quad_origin );
+        CHECK( buffer.submap_exists( quad_origin + point_east ) );
+        CHECK( buffer.is_compacted( quad_origin + point_east ) );
+    }
+
+    SECTION( "a quad with anything besides terrain is kept" ) {
+        submap *sm = buffer.lookup_submap( quad_origin + point_east );
+        REQUIRE( sm != nullptr );
+        SECTION( "items" ) {
+            sm->get_items( point_south ).insert( item( "rock" ) );
+        }
+        SECTION( "furniture" ) {
+            sm->set_furn( point_south, furn_id( 1 ) );
+        }
+        SECTION( "a field" ) {
+            sm->get_field( point_south ).add_field( fd_fire.id(), 1 );
+            sm->field_count++;
+        }
+        buffer.compact_uniform_submaps( quad_origin );
+        CHECK_FALSE( buffer.is_compacted( quad_origin ) );
+        CHECK_FALSE( buffer.is_compacted( quad_origin + point_east ) );
+        CHECK( buffer.lookup_submap( quad_origin + point_east ) == sm );
+    }
+
+    SECTION( "only the area the bubble left is looked at" ) {
+        buffer.compact_uniform_submaps( quad_origin + point( 100, 100 ) );
+        CHECK_FALSE( buffer.is_compacted( quad_origin ) );
+    }
+}
@@ -0,0 +1,19 @@
+#include <chrono>
+#include <thread>
+
+#include "cata_catch.h"
+#include "ui_manager.h"
+
+TEST_CASE( "frame_due_paces_redraws", "[ui]" )
+{
+    ui_manager::redraw();
+    // 0 means no limit, so a frame is always due
+    CHECK( ui_manager::frame_due( 0 ) );
+    // A frame was just drawn, the next one at 1 fps is a second away
+    CHECK_FALSE( ui_manager::frame_due( 1 ) );
+
+    std::this_thread::sleep_for( std::chrono::milliseconds( 20 ) );
+    // 20 ms later a frame is due at 100 fps, but not yet at 1 fps
+    CHECK( ui_manager::frame_due( 100 ) );
+    CHECK_FALSE( ui_manager::frame_due( 1 ) );
+}
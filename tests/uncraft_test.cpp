@@ -223,3 +223,14 @@ TEST_CASE( "uncraft from a damaged item", "[uncraft][damage]" )
     }
 }
 
+TEST_CASE( "uncraft requirements are built once per recipe", "[uncraft]" )
+{
+    const recipe &uncraft_rags = recipe_dictionary::get_uncraft( itype_test_rag_bundle );
+    REQUIRE( uncraft_rags.is_reversible() );
+
+    const requirement_data &reqs = uncraft_rags.disassembly_requirements();
+    CHECK( &uncraft_rags.disassembly_requirements() == &reqs );
+    CHECK_FALSE( reqs.get_components().empty() );
+    CHECK( uncraft_rags.simple_requirements().disassembly_requirements().get_components().size() ==
+           reqs.get_components().size() );
+}
@@ -0,0 +1,52 @@
+#include "avatar.h"
+#include "calendar.h"
+#include "cata_catch.h"
+#include "item.h"
+#include "map_helpers.h"
+#include "player_helpers.h"
+#include "point.h"
+#include "units.h"
+
+TEST_CASE( "weight carried is kept up to date across moves", "[character][weight]" )
+{
+    clear_map();
+    clear_avatar();
+    avatar &dummy = get_avatar();
+    const item rock( "rock" );
+    const item pile( "test_platinum_bit", calendar::turn, 100 );
+    item weapon( rock );
+    dummy.wield( weapon );
+    dummy.setpos( dummy.pos() + tripoint_east );
+    REQUIRE( dummy.weight_carried() == rock.weight() );
+
+    dummy.worn.wear_item( dummy, item( "backpack" ), false, false );
+    dummy.setpos( dummy.pos() + tripoint_west );
+    const units::mass backpack_weight = item( "backpack" ).weight();
+    CHECK( dummy.weight_carried() == rock.weight() + backpack_weight );
+
+    dummy.i_add( pile );
+    dummy.setpos( dummy.pos() + tripoint_east );
+    CHECK( dummy.weight_carried() == rock.weight() + backpack_weight + pile.weight() );
+}
+
+TEST_CASE( "weight carried follows items changed without notice after a move",
+           "[character][weight]" )
+{
+    clear_map();
+    clear_avatar();
+    avatar &dummy = get_avatar();
+    item weapon( "test_platinum_bit", calendar::turn, 100 );
+    const units::mass full_weight = weapon.weight();
+    dummy.wield( weapon );
+    dummy.setpos( dummy.pos() + tripoint_east );
+    REQUIRE( dummy.weight_carried() == full_weight );
+
+    // Charges used up in place don't invalidate the cache, moving does
+    dummy.get_wielded_item()->charges -= 50;
+    dummy.setpos( dummy.pos() + tripoint_west );
+    CHECK( dummy.weight_carried() == full_weight / 2 );
+
+    dummy.remove_weapon();
+    dummy.setpos( dummy.pos() + tripoint_east );
+    CHECK( dummy.weight_carried() == 0_gram );
+}
@@ -461,6 +461,31 @@ TEST_CASE( "widgets showing avatar stats with color for normal value", "[widget]
     }
 }
 
+TEST_CASE( "widget layout is reused only while its inputs are unchanged", "[widget][cache]" )
+{
+    widget str_w = widget_test_str_color_num.obj();
+    widget fatigue_w = widget_test_fatigue_clause.obj();
+
+    avatar &ava = get_avatar();
+    clear_avatar();
+
+    // Plain value widgets can be cached, conditional clauses must be evaluated every time
+    CHECK( str_w.renders_from_value_only() );
+    CHECK_FALSE( fatigue_w.renders_from_value_only() );
+
+    ava.str_max = 8;
+    CHECK( str_w.layout( ava ) == "STR: <color_c_white>8</color>" );
+    CHECK( str_w.layout( ava ) == "STR: <color_c_white>8</color>" );
+    // Layout width is part of the cached inputs
+    CHECK( str_w.layout( ava, 10 ) == "STR:     <color_c_white>8</color>" );
+    CHECK( str_w.layout( ava ) == "STR: <color_c_white>8</color>" );
+    // So is the value
+    ava.set_str_bonus( -1 );
+    CHECK( str_w.layout( ava ) == "STR: <color_c_yellow>7</color>" );
+    ava.set_str_bonus( 0 );
+    CHECK( str_w.layout( ava ) == "STR: <color_c_white>8</color>" );
+}
+
 TEST_CASE( "widget showing character fatigue status", "[widget]" )
 {
     widget fatigue_w = widget_test_fatigue_clause.obj();